@@ -0,0 +1,40 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <chrono>
+
+namespace Excep
+{
+
+/// @brief 측정 결과가 최적화로 제거되지 않도록 값을 흘려보내는 곳
+extern volatile uint64 g_benchmarkSink;
+
+/// @brief 함수를 여러 번 측정하여 가장 빠른 1회 실행 시간을 반환
+/// @param trials 측정 횟수 (가장 빠른 값 사용, 첫 측정은 캐시/할당 워밍업 역할)
+/// @param func 측정할 함수 객체
+/// @return 가장 빠른 실행 시간 (초)
+template<typename Func>
+float64 MeasureBestSeconds(uint32 trials, Func&& func)
+{
+    float64 best = 0.0;
+    for (uint32 trial = 0; trial < trials; ++trial)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto stop = std::chrono::steady_clock::now();
+
+        const float64 seconds = std::chrono::duration<float64>(stop - start).count();
+        if (trial == 0 || seconds < best)
+        {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+/// @brief UTF-8/UTF-16 변환의 SSE2 경로와 스칼라 경로 처리량 비교
+void RunStringConversionBenchmark();
+
+/// @brief 읽기 위주 작업에서 ConcurrentHashMap의 스레드 수별 처리량과 확장 비율 측정
+void RunConcurrentHashMapBenchmark();
+
+} // namespace Excep
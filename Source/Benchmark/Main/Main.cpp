@@ -0,0 +1,55 @@
+﻿#include "Main/Benchmark.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace Excep;
+
+namespace Excep
+{
+
+volatile uint64 g_benchmarkSink = 0;
+
+} // namespace Excep
+
+namespace
+{
+
+struct BenchmarkEntry
+{
+    const char8* name;
+    void (*run)();
+};
+
+const BenchmarkEntry BENCHMARKS[] =
+{
+    { "StringConversion", &RunStringConversionBenchmark },
+    { "ConcurrentHashMap", &RunConcurrentHashMapBenchmark },
+};
+
+} // namespace
+
+// 사용법: Benchmark.exe [이름...]  (이름을 생략하면 모든 벤치마크 실행)
+// Release 구성으로 빌드하여 실행해야 의미 있는 수치가 나옵니다
+int main(int argc, char* argv[])
+{
+    for (const BenchmarkEntry& entry : BENCHMARKS)
+    {
+        bool8 selected = (argc <= 1);
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], entry.name) == 0)
+            {
+                selected = true;
+            }
+        }
+
+        if (selected)
+        {
+            std::printf("== %s ==\n", entry.name);
+            entry.run();
+            std::printf("\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+﻿#include "Main/Benchmark.h"
+#include "Container/ConcurrentHashMap.h"
+#include "Container/DynamicArray.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace Excep
+{
+
+namespace
+{
+
+constexpr uint64 KEY_COUNT = 1 << 16;
+constexpr uint64 OPS_PER_THREAD = 1 << 21;
+constexpr uint32 TRIALS = 3;
+constexpr uint32 MIN_MAX_THREADS = 16;
+
+using Map = ConcurrentHashMap<uint64, uint64>;
+
+/// @brief 스레드마다 독립된 의사 난수 (xorshift64)
+uint64 NextRandom(uint64& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/// @brief 한 스레드의 작업: 무작위 Key를 조회하고 writePerMille/1000 비율로 제거 후 다시 삽입
+/// @param outSum 조회한 Value의 합을 받을 변수 (스레드마다 따로 두고 join 후에 합침)
+void RunWorker(Map& map, uint64 seed, uint32 writePerMille, std::atomic<uint32>& ready, const std::atomic<bool8>& go,
+               uint64& outSum)
+{
+    uint64 state = seed * 0x9E3779B97F4A7C15ull + 1;
+    uint64 sum = 0;
+
+    ready.fetch_add(1, std::memory_order_release);
+    while (!go.load(std::memory_order_acquire))
+    {
+        CpuPause();
+    }
+
+    for (uint64 op = 0; op < OPS_PER_THREAD; ++op)
+    {
+        const uint64 random = NextRandom(state);
+        const uint64 key = random & (KEY_COUNT - 1);
+        if ((random >> 32) % 1000 < writePerMille)
+        {
+            map.Remove(key);
+            map.Insert(key, key);
+        }
+        else
+        {
+            uint64 value = 0;
+            map.TryGet(key, value);
+            sum += value;
+        }
+    }
+
+    outSum = sum;
+}
+
+/// @brief 스레드 수만큼 작업을 동시에 시작하여 가장 빠른 경과 시간을 반환 (스레드 생성 시간 제외)
+float64 MeasureThreads(Map& map, uint32 threadCount, uint32 writePerMille)
+{
+    float64 best = 0.0;
+    for (uint32 trial = 0; trial < TRIALS; ++trial)
+    {
+        std::atomic<uint32> ready(0);
+        std::atomic<bool8> go(false);
+
+        DynamicArray<uint64> sums;
+        sums.Resize(threadCount, 0);
+        DynamicArray<std::thread> threads;
+        threads.Reserve(threadCount);
+        for (uint32 i = 0; i < threadCount; ++i)
+        {
+            threads.Emplace(RunWorker, std::ref(map), static_cast<uint64>(i), writePerMille,
+                            std::ref(ready), std::cref(go), std::ref(sums[i]));
+        }
+        while (ready.load(std::memory_order_acquire) < threadCount)
+        {
+            std::this_thread::yield();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+
+        for (uint64 sum : sums)
+        {
+            g_benchmarkSink = g_benchmarkSink + sum;
+        }
+
+        const float64 seconds = std::chrono::duration<float64>(stop - start).count();
+        if (trial == 0 || seconds < best)
+        {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+/// @brief 스레드 수를 두 배씩 늘리며 전체 처리량과 1스레드 대비 확장 비율 출력
+void RunCase(const char8* name, uint32 writePerMille, uint32 maxThreads)
+{
+    Map map;
+    for (uint64 key = 0; key < KEY_COUNT; ++key)
+    {
+        map.Insert(key, key);
+    }
+
+    float64 singleThreadOps = 0.0;
+    for (uint32 threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        const float64 seconds = MeasureThreads(map, threadCount, writePerMille);
+        const float64 opsPerSecond = static_cast<float64>(OPS_PER_THREAD * threadCount) / seconds;
+        if (threadCount == 1)
+        {
+            singleThreadOps = opsPerSecond;
+        }
+
+        const float64 scaling = opsPerSecond / singleThreadOps;
+        std::printf("%-10s  threads %2u  %8.1f Mops/s  x%5.2f  (efficiency %5.1f%%)\n",
+                    name, threadCount, opsPerSecond / 1e6, scaling, 100.0 * scaling / threadCount);
+    }
+}
+
+} // namespace
+
+void RunConcurrentHashMapBenchmark()
+{
+    // 하드웨어 스레드가 적어도 16스레드까지는 측정 (코어 수를 넘는 구간은 확장되지 않는 것이 정상)
+    const uint32 hardwareThreads = std::thread::hardware_concurrency();
+    const uint32 maxThreads = (hardwareThreads > MIN_MAX_THREADS) ? hardwareThreads : MIN_MAX_THREADS;
+    std::printf("hardware threads: %u, keys: %llu, ops per thread: %llu\n",
+                hardwareThreads, static_cast<unsigned long long>(KEY_COUNT),
+                static_cast<unsigned long long>(OPS_PER_THREAD));
+
+    RunCase("read-only", 0, maxThreads);
+    RunCase("1% write", 10, maxThreads);
+}
+
+} // namespace Excep
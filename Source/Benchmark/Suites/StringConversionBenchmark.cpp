@@ -0,0 +1,101 @@
+﻿#include "Main/Benchmark.h"
+#include "Container/StringConversion.h"
+#include <cstdio>
+
+namespace Excep
+{
+
+namespace
+{
+
+constexpr uint64 INPUT_BYTES = 4 * 1024 * 1024;
+constexpr uint32 TRIALS = 10;
+
+/// @brief 줄 단위 텍스트를 반복하여 약 INPUT_BYTES 크기의 UTF-8 입력 생성
+String8 MakeInput(const char8* const* lines, uint64 lineCount)
+{
+    String8 text;
+    uint64 line = 0;
+    while (text.GetLength() < INPUT_BYTES)
+    {
+        text += lines[line];
+        text += "\n";
+        line = (line + 1) % lineCount;
+    }
+    return text;
+}
+
+/// @brief 하나의 입력에 대해 두 방향 변환을 SIMD/스칼라 경로로 측정하여 출력
+void RunCase(const char8* name, const String8& utf8)
+{
+    const String16 utf16 = ToString16(utf8);
+
+    // 두 경로의 결과가 같아야 비교가 의미 있음
+    if (StringConversionDetail::ToString16Scalar(utf8) != utf16
+        || StringConversionDetail::ToString8Scalar(utf16) != ToString8(utf16))
+    {
+        std::printf("%-12s  result mismatch between SIMD and scalar paths\n", name);
+        return;
+    }
+
+    const float64 toUtf16Simd = MeasureBestSeconds(TRIALS, [&]()
+    {
+        g_benchmarkSink = g_benchmarkSink + ToString16(utf8).GetLength();
+    });
+    const float64 toUtf16Scalar = MeasureBestSeconds(TRIALS, [&]()
+    {
+        g_benchmarkSink = g_benchmarkSink + StringConversionDetail::ToString16Scalar(utf8).GetLength();
+    });
+    const float64 toUtf8Simd = MeasureBestSeconds(TRIALS, [&]()
+    {
+        g_benchmarkSink = g_benchmarkSink + ToString8(utf16).GetLength();
+    });
+    const float64 toUtf8Scalar = MeasureBestSeconds(TRIALS, [&]()
+    {
+        g_benchmarkSink = g_benchmarkSink + StringConversionDetail::ToString8Scalar(utf16).GetLength();
+    });
+
+    // 처리량은 UTF-8 입력 바이트 기준 (두 방향을 같은 기준으로 비교)
+    const float64 megabytes = static_cast<float64>(utf8.GetLength()) / (1024.0 * 1024.0);
+    std::printf("%-12s  UTF-8 -> UTF-16  SSE2 %8.1f MB/s  scalar %8.1f MB/s  x%.2f\n",
+                name, megabytes / toUtf16Simd, megabytes / toUtf16Scalar, toUtf16Scalar / toUtf16Simd);
+    std::printf("%-12s  UTF-16 -> UTF-8  SSE2 %8.1f MB/s  scalar %8.1f MB/s  x%.2f\n",
+                name, megabytes / toUtf8Simd, megabytes / toUtf8Scalar, toUtf8Scalar / toUtf8Simd);
+}
+
+} // namespace
+
+void RunStringConversionBenchmark()
+{
+    // 경로, 셰이더 이름, 로그처럼 대부분 ASCII인 텍스트
+    const char8* const asciiLines[] =
+    {
+        "Content/Shaders/Default.vs.hlsl",
+        "[Renderer] Created swap chain 1920x1080 (DXGI_FORMAT_R8G8B8A8_UNORM)",
+        "WObject 1024 spawned at (0.25, -0.50, 0.00) with CMeshRenderer",
+    };
+
+    // 대부분 ASCII이고 가끔 한글이 섞인 텍스트
+    const char8* const asciiHeavyLines[] =
+    {
+        "Content/Maps/Level01/Props/Barrel_01.asset",
+        "[World] Spawned 128 objects in 0.42 ms",
+        "Content/UI/메인메뉴/Button_Start.png",
+        "[Input] Key binding loaded: MoveForward=W, MoveBack=S",
+    };
+
+    // 한글과 ASCII가 짧게 번갈아 나오는 텍스트 (UI 문자열, 대화문)
+    const char8* const mixedLines[] =
+    {
+        "DirectX 11 렌더러 초기화 실패!",
+        "오브젝트 128개를 생성했습니다 (0.42 ms)",
+        "Mesh Type: 삼각형 / 큐브 / 구",
+        "저장하지 않은 변경 사항이 있습니다. 종료할까요? [Y/N]",
+    };
+
+    RunCase("ASCII", MakeInput(asciiLines, 3));
+    RunCase("ASCII-heavy", MakeInput(asciiHeavyLines, 4));
+    RunCase("Mixed", MakeInput(mixedLines, 4));
+}
+
+} // namespace Excep
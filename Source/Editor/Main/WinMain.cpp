@@ -3,6 +3,7 @@
 #include "Input/InputManager.h"
 #include "Math/Vector3.h"
 #include "Container/DynamicArray.h"
+#include "Memory/FrameArena.h"
 #include "World/World.h"
 #include "World/WObject.h"
 #include "World/CTransform.h"
@@ -25,6 +26,7 @@ UniquePtr<InputManager> g_inputManager;
 HWND g_hwnd = nullptr;
 bool8 g_isRunning = true;
 UniquePtr<World> g_world;
+UniquePtr<FrameArena> g_frameArena;
 
 // 전방 선언
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
@@ -122,17 +124,17 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                 // Object Spawner UI
                 static float32 spawnX = 0.0f;
                 static float32 spawnY = 0.0f;
-                static MeshType selectedType = MeshType::Triangle;
+                static int32 selectedType = static_cast<int32>(MeshType::Triangle);
 
                 ImGui::Begin("Object Spawner");
 
                 // 메시 타입 선택
                 ImGui::Text("Mesh Type:");
-                ImGui::RadioButton("Triangle", (int*)&selectedType, (int)MeshType::Triangle);
+                ImGui::RadioButton("Triangle", &selectedType, static_cast<int32>(MeshType::Triangle));
                 ImGui::SameLine();
-                ImGui::RadioButton("Cube", (int*)&selectedType, (int)MeshType::Cube);
+                ImGui::RadioButton("Cube", &selectedType, static_cast<int32>(MeshType::Cube));
                 ImGui::SameLine();
-                ImGui::RadioButton("Sphere", (int*)&selectedType, (int)MeshType::Sphere);
+                ImGui::RadioButton("Sphere", &selectedType, static_cast<int32>(MeshType::Sphere));
 
                 ImGui::Separator();
                 ImGui::DragFloat("Spawn X", &spawnX, 0.01f, -1.0f, 1.0f);
@@ -142,7 +144,7 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                 {
                     WObject* obj = g_world->SpawnObject();
                     CMeshRenderer* meshRenderer = obj->AddComponent<CMeshRenderer>();
-                    meshRenderer->SetMeshType(selectedType);
+                    meshRenderer->SetMeshType(static_cast<MeshType>(selectedType));
                     obj->GetTransform()->SetPosition(Vector3(spawnX, spawnY, 0.0f));
                 }
 
@@ -154,6 +156,8 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
 
                 ImGui::Separator();
                 ImGui::Text("Total Objects: %llu", g_world->GetObjectCount());
+                ImGui::Text("Frame Memory Peak: %llu / %llu KB",
+                            g_frameArena->GetPeakBytes() / 1024, g_frameArena->GetCapacity() / 1024);
 
                 WObject* lastObj = g_world->GetLastObject();
                 if (lastObj)
@@ -184,7 +188,7 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                 ImGui::End();
 
                 // 1. Engine 렌더링 (Clear + Draw)
-                g_world->Render(g_renderer.Get());
+                g_world->Render(g_renderer.Get(), *g_frameArena);
 
                 // 2. ImGui 렌더링 (UI 오버레이)
                 ImGui::Render();
@@ -195,6 +199,9 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
 
                 // 프레임 끝에 InputManager 업데이트 (다음 프레임 준비)
                 g_inputManager->Update();
+
+                // 프레임 임시 메모리 버퍼 전환 (직전 프레임 메모리 회수)
+                g_frameArena->EndFrame();
             }
         }
     }
@@ -204,6 +211,7 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
     g_world.Reset();
+    g_frameArena.Reset();
     g_inputManager.Reset();
     g_renderer.Reset();
 
@@ -257,6 +265,9 @@ BOOL InitInstance(HINSTANCE hInstance, int nCmdShow)
     // InputManager 초기화
     g_inputManager = MakeUnique<InputManager>();
 
+    // 프레임 임시 메모리 초기화
+    g_frameArena = MakeUnique<FrameArena>();
+
     // World 초기화
     g_world = MakeUnique<World>();
 
@@ -0,0 +1,1121 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Memory/Allocator.h"
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief Value가 없는 B+트리(TreeSet)에서 Value 자리에 쓰는 빈 타입
+struct BTreeNoValue
+{
+};
+
+/// @brief 노드 하나에 담는 Key 개수
+/// @note Key 배열이 약 256바이트(캐시 라인 4개)가 되도록 정하고 8 ~ 64개로 제한합니다
+template<typename K>
+struct BTreeNodeCapacity
+{
+    static constexpr uint64 RAW = 256 / sizeof(K);
+    static constexpr uint64 VALUE = (RAW < 8) ? 8 : ((RAW > 64) ? 64 : RAW);
+};
+
+/// @brief 리프 노드의 Value 배열 (생성/소멸은 트리가 직접 관리)
+template<typename V, uint64 N>
+struct BTreeValueArray
+{
+    V* Get(uint64 index) { return reinterpret_cast<V*>(m_storage) + index; }
+
+    alignas(V) uint8 m_storage[N * sizeof(V)];
+};
+
+/// @brief Value가 없는 경우 모든 인덱스가 하나의 빈 객체를 가리키도록 하여 공간을 쓰지 않음
+template<uint64 N>
+struct BTreeValueArray<BTreeNoValue, N>
+{
+    BTreeNoValue* Get(uint64) { return &m_empty; }
+
+    BTreeNoValue m_empty;
+};
+
+/// @brief 리프와 내부 노드의 공통 헤더
+struct BTreeNode
+{
+    explicit BTreeNode(bool8 isLeaf)
+        : count(0)
+        , isLeaf(isLeaf)
+    {
+    }
+
+    uint32 count;
+    bool8 isLeaf;
+};
+
+/// @brief 내부 노드: count개의 구분 Key와 count + 1개의 자식
+/// @note children[i]의 모든 Key는 keys[i]보다 작고, children[i + 1]의 모든 Key는 keys[i] 이상입니다
+template<typename K, uint64 N>
+struct BTreeInternal : BTreeNode
+{
+    BTreeInternal()
+        : BTreeNode(false)
+    {
+    }
+
+    K* Key(uint64 index) { return reinterpret_cast<K*>(keys) + index; }
+
+    BTreeNode* children[N + 1];
+    alignas(K) uint8 keys[N * sizeof(K)];
+};
+
+/// @brief 리프 노드: Key와 Value를 각각 연속된 배열에 저장하고, 정렬 순서대로 양방향 연결됨
+template<typename K, typename V, uint64 N>
+struct BTreeLeaf : BTreeNode
+{
+    BTreeLeaf()
+        : BTreeNode(true)
+        , prev(nullptr)
+        , next(nullptr)
+    {
+    }
+
+    K* Key(uint64 index) { return reinterpret_cast<K*>(keys) + index; }
+    V* Value(uint64 index) { return values.Get(index); }
+
+    BTreeLeaf* prev;
+    BTreeLeaf* next;
+    alignas(K) uint8 keys[N * sizeof(K)];
+    BTreeValueArray<V, N> values;
+};
+
+/// @brief 반복자가 돌려주는 참조 타입 (TreeMap: Key/Value 참조 쌍)
+template<typename K, typename V, bool8 IS_CONST>
+struct BTreeReference
+{
+    using ValueRef = typename std::conditional<IS_CONST, const V&, V&>::type;
+    using Type = std::pair<const K&, ValueRef>;
+
+    /// @brief operator->를 위해 참조 쌍을 들고 있는 임시 객체
+    struct Pointer
+    {
+        const Type* operator->() const { return &ref; }
+
+        Type ref;
+    };
+
+    static Type Make(const K& key, V& value) { return Type(key, value); }
+    static Pointer MakePointer(const K& key, V& value) { return Pointer{Type(key, value)}; }
+};
+
+/// @brief 반복자가 돌려주는 참조 타입 (TreeSet: Key의 const 참조)
+template<typename K, bool8 IS_CONST>
+struct BTreeReference<K, BTreeNoValue, IS_CONST>
+{
+    using Type = const K&;
+    using Pointer = const K*;
+
+    static Type Make(const K& key, BTreeNoValue&) { return key; }
+    static Pointer MakePointer(const K& key, BTreeNoValue&) { return &key; }
+};
+
+/// @brief B+트리의 양방향 반복자 (리프 연결 리스트를 따라 정렬 순서로 순회)
+/// @tparam K Key 타입
+/// @tparam V Value 타입
+/// @tparam N 노드 용량
+/// @tparam IS_CONST const 반복자 여부
+template<typename K, typename V, uint64 N, bool8 IS_CONST>
+class BTreeIterator
+{
+private:
+    using Leaf = BTreeLeaf<K, V, N>;
+    using RefPolicy = BTreeReference<K, V, IS_CONST>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename std::remove_cv<typename std::remove_reference<typename RefPolicy::Type>::type>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename RefPolicy::Pointer;
+    using reference = typename RefPolicy::Type;
+
+    BTreeIterator()
+        : m_leaf(nullptr)
+        , m_index(0)
+    {
+    }
+
+    BTreeIterator(Leaf* leaf, uint64 index)
+        : m_leaf(leaf)
+        , m_index(index)
+    {
+    }
+
+    /// @brief 비 const 반복자에서 const 반복자로 변환
+    template<bool8 OTHER_CONST, typename = typename std::enable_if<IS_CONST && !OTHER_CONST>::type>
+    BTreeIterator(const BTreeIterator<K, V, N, OTHER_CONST>& other)
+        : m_leaf(other.m_leaf)
+        , m_index(other.m_index)
+    {
+    }
+
+    reference operator*() const { return RefPolicy::Make(*m_leaf->Key(m_index), *m_leaf->Value(m_index)); }
+    pointer operator->() const { return RefPolicy::MakePointer(*m_leaf->Key(m_index), *m_leaf->Value(m_index)); }
+
+    BTreeIterator& operator++()
+    {
+        // 마지막 리프의 끝(End)에서만 index == count 상태로 남음
+        ++m_index;
+        if (m_index == m_leaf->count && m_leaf->next != nullptr)
+        {
+            m_leaf = m_leaf->next;
+            m_index = 0;
+        }
+        return *this;
+    }
+
+    BTreeIterator operator++(int)
+    {
+        BTreeIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    BTreeIterator& operator--()
+    {
+        if (m_index == 0)
+        {
+            m_leaf = m_leaf->prev;
+            m_index = m_leaf->count;
+        }
+        --m_index;
+        return *this;
+    }
+
+    BTreeIterator operator--(int)
+    {
+        BTreeIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    bool8 operator==(const BTreeIterator& other) const
+    {
+        return m_leaf == other.m_leaf && m_index == other.m_index;
+    }
+
+    bool8 operator!=(const BTreeIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    Leaf* m_leaf;
+    uint64 m_index;
+
+    template<typename OK, typename OV, uint64 ON, bool8 OTHER_CONST>
+    friend class BTreeIterator;
+};
+
+/// @brief 넓은 노드를 사용하는 B+트리 (TreeMap/TreeSet의 저장소)
+/// @tparam K Key 타입 (복사 가능해야 함, 내부 노드에 구분 Key로 복사됨)
+/// @tparam V Value 타입 (TreeSet은 BTreeNoValue)
+/// @tparam Compare Key 비교 함수 객체 (strict weak ordering)
+/// @tparam Alloc 엔진 할당자 타입 (빈 타입이면 EBO로 크기 비용 없음)
+/// @note Key는 노드마다 연속 배열로 저장되어 노드 내 탐색이 캐시 라인 몇 개 안에서 끝나고,
+///       리프는 연결 리스트로 이어져 정렬 순회가 포인터 추적 없이 배열을 순서대로 읽습니다.
+///       삽입/삭제 시 요소가 노드 사이로 이동하므로 기존 포인터와 반복자는 모두 무효화됩니다.
+template<typename K, typename V, typename Compare, typename Alloc>
+class BPlusTree : private Alloc
+{
+public:
+    static constexpr uint64 NODE_CAPACITY = BTreeNodeCapacity<K>::VALUE;
+
+    using Iterator = BTreeIterator<K, V, NODE_CAPACITY, false>;
+    using ConstIterator = BTreeIterator<K, V, NODE_CAPACITY, true>;
+
+    BPlusTree()
+        : m_root(nullptr)
+        , m_first(nullptr)
+        , m_last(nullptr)
+        , m_size(0)
+    {
+    }
+
+    explicit BPlusTree(const Alloc& allocator)
+        : Alloc(allocator)
+        , m_root(nullptr)
+        , m_first(nullptr)
+        , m_last(nullptr)
+        , m_size(0)
+    {
+    }
+
+    BPlusTree(const BPlusTree& other)
+        : BPlusTree(other.GetAllocator())
+    {
+        CopyFrom(other);
+    }
+
+    BPlusTree(BPlusTree&& other) noexcept
+        : BPlusTree(other.GetAllocator())
+    {
+        Swap(other);
+    }
+
+    ~BPlusTree()
+    {
+        Clear();
+    }
+
+    BPlusTree& operator=(const BPlusTree& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    BPlusTree& operator=(BPlusTree&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+    /// @brief Key와 같은 요소 찾기
+    /// @param key 찾을 키 (Compare가 K와 비교할 수 있는 타입)
+    /// @return 요소의 반복자 (없으면 End)
+    template<typename Q>
+    Iterator Find(const Q& key) const
+    {
+        if (m_root == nullptr)
+        {
+            return Iterator();
+        }
+
+        Leaf* leaf = FindLeaf(key);
+        uint64 index = LowerIndex(leaf->Key(0), leaf->count, key, LinearSearch());
+        if (index < leaf->count && !Less(key, *leaf->Key(index)))
+        {
+            return Iterator(leaf, index);
+        }
+        return EndIterator();
+    }
+
+    /// @brief Key 이상인 첫 번째 요소 찾기
+    /// @param key 기준 키 (Compare가 K와 비교할 수 있는 타입)
+    /// @return 요소의 반복자 (없으면 End)
+    template<typename Q>
+    Iterator LowerBound(const Q& key) const
+    {
+        if (m_root == nullptr)
+        {
+            return Iterator();
+        }
+
+        Leaf* leaf = FindLeaf(key);
+        return MakeIterator(leaf, LowerIndex(leaf->Key(0), leaf->count, key, LinearSearch()));
+    }
+
+    /// @brief Key보다 큰 첫 번째 요소 찾기
+    /// @param key 기준 키 (Compare가 K와 비교할 수 있는 타입)
+    /// @return 요소의 반복자 (없으면 End)
+    template<typename Q>
+    Iterator UpperBound(const Q& key) const
+    {
+        if (m_root == nullptr)
+        {
+            return Iterator();
+        }
+
+        Leaf* leaf = FindLeaf(key);
+        return MakeIterator(leaf, UpperIndex(leaf->Key(0), leaf->count, key, LinearSearch()));
+    }
+
+    /// @brief Key가 없을 때만 Value를 생성하여 삽입
+    /// @param key 키
+    /// @param args Value 생성자 인자들
+    /// @return (요소의 반복자, 새로 삽입되었으면 true)
+    template<typename... Args>
+    std::pair<Iterator, bool8> TryEmplace(const K& key, Args&&... args)
+    {
+        PathEntry path[MAX_DEPTH];
+        uint64 depth = 0;
+        Leaf* leaf = nullptr;
+        uint64 index = 0;
+
+        if (m_root != nullptr)
+        {
+            leaf = FindLeaf(key, path, depth);
+            index = LowerIndex(leaf->Key(0), leaf->count, key, LinearSearch());
+            if (index < leaf->count && !Less(key, *leaf->Key(index)))
+            {
+                return std::pair<Iterator, bool8>(Iterator(leaf, index), false);
+            }
+        }
+
+        // 요소를 먼저 만들어 두면 생성 중 예외가 나도 트리는 변경되지 않음
+        K newKey(key);
+        V newValue(std::forward<Args>(args)...);
+
+        if (leaf == nullptr)
+        {
+            leaf = NewLeaf();
+            m_root = leaf;
+            m_first = leaf;
+            m_last = leaf;
+        }
+
+        if (leaf->count < NODE_CAPACITY)
+        {
+            InsertEntry(leaf, index, std::move(newKey), std::move(newValue));
+            ++m_size;
+            return std::pair<Iterator, bool8>(Iterator(leaf, index), true);
+        }
+
+        // 분할에 필요한 노드(새 리프, 가득 찬 조상마다 형제, 루트까지 가득 차면 새 루트)와
+        // 구분 Key를 트리를 바꾸기 전에 모두 준비하여, 할당이나 복사가 실패해도 트리가 변경되지 않도록 함
+        const uint64 half = NODE_CAPACITY / 2;
+        K separator(*leaf->Key(half));
+        InternalReserve reserve(*this);
+        uint64 level = depth;
+        while (level > 0 && path[level - 1].node->count == NODE_CAPACITY)
+        {
+            reserve.Add();
+            --level;
+        }
+        if (level == 0)
+        {
+            reserve.Add();
+        }
+        Leaf* right = NewLeaf();
+
+        // 리프 분할: 뒤쪽 절반을 새 리프로 옮기고 연결 리스트에 끼워 넣음
+        // (새 요소는 어느 쪽에 들어가든 원래의 half 번째 Key가 오른쪽 리프의 첫 Key가 됨)
+        for (uint64 i = half; i < NODE_CAPACITY; ++i)
+        {
+            MoveEntry(right, i - half, leaf, i);
+        }
+        right->count = static_cast<uint32>(NODE_CAPACITY - half);
+        leaf->count = static_cast<uint32>(half);
+
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next != nullptr)
+        {
+            leaf->next->prev = right;
+        }
+        else
+        {
+            m_last = right;
+        }
+        leaf->next = right;
+
+        Leaf* target = leaf;
+        if (index > half)
+        {
+            target = right;
+            index -= half;
+        }
+        InsertEntry(target, index, std::move(newKey), std::move(newValue));
+        ++m_size;
+
+        InsertIntoParent(path, depth, leaf, std::move(separator), right, reserve);
+        return std::pair<Iterator, bool8>(Iterator(target, index), true);
+    }
+
+    /// @brief Key에 해당하는 요소 제거
+    /// @param key 제거할 키 (Compare가 K와 비교할 수 있는 타입)
+    /// @return 제거 성공 시 true
+    template<typename Q>
+    bool8 Remove(const Q& key)
+    {
+        if (m_root == nullptr)
+        {
+            return false;
+        }
+
+        PathEntry path[MAX_DEPTH];
+        uint64 depth = 0;
+        Leaf* leaf = FindLeaf(key, path, depth);
+        uint64 index = LowerIndex(leaf->Key(0), leaf->count, key, LinearSearch());
+        if (index >= leaf->count || Less(key, *leaf->Key(index)))
+        {
+            return false;
+        }
+
+        DestroyEntry(leaf, index);
+        ShiftLeft(leaf, index);
+        --leaf->count;
+        --m_size;
+
+        if (depth == 0)
+        {
+            if (leaf->count == 0)
+            {
+                FreeLeaf(leaf);
+                m_root = nullptr;
+                m_first = nullptr;
+                m_last = nullptr;
+            }
+            return true;
+        }
+
+        if (leaf->count < MIN_LEAF_COUNT)
+        {
+            RebalanceLeaf(leaf, path[depth - 1]);
+            RebalanceInternal(path, depth - 1);
+        }
+        return true;
+    }
+
+    /// @brief 모든 요소와 노드 제거
+    void Clear()
+    {
+        if (m_root != nullptr)
+        {
+            DestroyNode(m_root);
+        }
+        m_root = nullptr;
+        m_first = nullptr;
+        m_last = nullptr;
+        m_size = 0;
+    }
+
+    const Alloc& GetAllocator() const { return *this; }
+    uint64 GetSize() const { return m_size; }
+
+    Iterator Begin() const { return (m_first != nullptr) ? Iterator(m_first, 0) : Iterator(); }
+    Iterator End() const { return EndIterator(); }
+
+private:
+    using Leaf = BTreeLeaf<K, V, NODE_CAPACITY>;
+    using Internal = BTreeInternal<K, NODE_CAPACITY>;
+
+    /// @brief 정수/실수/포인터 Key는 분기 없는 선형 탐색, 그 외에는 이진 탐색
+    using LinearSearch = std::integral_constant<bool8, std::is_arithmetic<K>::value || std::is_pointer<K>::value>;
+
+    // 분할 직후 리프는 절반, 내부 노드는 절반에서 구분 Key 하나를 뺀 만큼을 가짐
+    static constexpr uint64 MIN_LEAF_COUNT = NODE_CAPACITY / 2;
+    static constexpr uint64 MIN_INTERNAL_COUNT = (NODE_CAPACITY - 1) / 2;
+
+    // 내부 노드의 최소 자식 수가 4 이상이므로 2^64개의 요소도 이 깊이 안에 들어감
+    static constexpr uint64 MAX_DEPTH = 32;
+
+    /// @brief 루트에서 리프까지 내려온 경로 (내부 노드와 선택한 자식 인덱스)
+    struct PathEntry
+    {
+        Internal* node;
+        uint64 index;
+    };
+
+    template<typename L, typename R>
+    static bool8 Less(const L& lhs, const R& rhs)
+    {
+        return Compare()(lhs, rhs);
+    }
+
+    /// @brief key보다 작은 Key의 개수 (= lower_bound 위치)
+    /// @note 정렬된 배열에서 개수를 세는 것은 lower_bound와 같고, 분기가 없어 컴파일러가 SIMD로 벡터화합니다
+    template<typename Q>
+    static uint64 LowerIndex(const K* keys, uint64 count, const Q& key, std::true_type)
+    {
+        uint64 index = 0;
+        for (uint64 i = 0; i < count; ++i)
+        {
+            index += Less(keys[i], key) ? 1 : 0;
+        }
+        return index;
+    }
+
+    template<typename Q>
+    static uint64 LowerIndex(const K* keys, uint64 count, const Q& key, std::false_type)
+    {
+        uint64 low = 0;
+        uint64 high = count;
+        while (low < high)
+        {
+            uint64 mid = (low + high) / 2;
+            if (Less(keys[mid], key))
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    /// @brief key 이하인 Key의 개수 (= upper_bound 위치)
+    template<typename Q>
+    static uint64 UpperIndex(const K* keys, uint64 count, const Q& key, std::true_type)
+    {
+        uint64 index = 0;
+        for (uint64 i = 0; i < count; ++i)
+        {
+            index += Less(key, keys[i]) ? 0 : 1;
+        }
+        return index;
+    }
+
+    template<typename Q>
+    static uint64 UpperIndex(const K* keys, uint64 count, const Q& key, std::false_type)
+    {
+        uint64 low = 0;
+        uint64 high = count;
+        while (low < high)
+        {
+            uint64 mid = (low + high) / 2;
+            if (Less(key, keys[mid]))
+            {
+                high = mid;
+            }
+            else
+            {
+                low = mid + 1;
+            }
+        }
+        return low;
+    }
+
+    template<typename Q>
+    Leaf* FindLeaf(const Q& key) const
+    {
+        BTreeNode* node = m_root;
+        while (!node->isLeaf)
+        {
+            Internal* internal = static_cast<Internal*>(node);
+            node = internal->children[UpperIndex(internal->Key(0), internal->count, key, LinearSearch())];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    template<typename Q>
+    Leaf* FindLeaf(const Q& key, PathEntry* path, uint64& depth) const
+    {
+        BTreeNode* node = m_root;
+        while (!node->isLeaf)
+        {
+            Internal* internal = static_cast<Internal*>(node);
+            uint64 index = UpperIndex(internal->Key(0), internal->count, key, LinearSearch());
+            path[depth].node = internal;
+            path[depth].index = index;
+            ++depth;
+            node = internal->children[index];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    Iterator EndIterator() const
+    {
+        return (m_last != nullptr) ? Iterator(m_last, m_last->count) : Iterator();
+    }
+
+    /// @brief 리프 끝을 가리키는 위치는 다음 리프의 첫 요소로 정규화
+    Iterator MakeIterator(Leaf* leaf, uint64 index) const
+    {
+        if (index == leaf->count && leaf->next != nullptr)
+        {
+            return Iterator(leaf->next, 0);
+        }
+        return Iterator(leaf, index);
+    }
+
+    void InsertEntry(Leaf* leaf, uint64 index, K&& key, V&& value)
+    {
+        for (uint64 i = leaf->count; i > index; --i)
+        {
+            MoveEntry(leaf, i, leaf, i - 1);
+        }
+        new (leaf->Key(index)) K(std::move(key));
+        new (leaf->Value(index)) V(std::move(value));
+        ++leaf->count;
+    }
+
+    /// @brief 요소를 다른 위치로 옮기고 원래 위치의 객체를 소멸
+    static void MoveEntry(Leaf* dst, uint64 dstIndex, Leaf* src, uint64 srcIndex)
+    {
+        new (dst->Key(dstIndex)) K(std::move(*src->Key(srcIndex)));
+        new (dst->Value(dstIndex)) V(std::move(*src->Value(srcIndex)));
+        DestroyEntry(src, srcIndex);
+    }
+
+    static void DestroyEntry(Leaf* leaf, uint64 index)
+    {
+        leaf->Key(index)->~K();
+        leaf->Value(index)->~V();
+    }
+
+    /// @brief index 위치가 비어있을 때 뒤쪽 요소들을 한 칸씩 앞으로 당김 (count는 호출자가 갱신)
+    static void ShiftLeft(Leaf* leaf, uint64 index)
+    {
+        for (uint64 i = index; i + 1 < leaf->count; ++i)
+        {
+            MoveEntry(leaf, i, leaf, i + 1);
+        }
+    }
+
+    static void MoveKey(Internal* dst, uint64 dstIndex, Internal* src, uint64 srcIndex)
+    {
+        new (dst->Key(dstIndex)) K(std::move(*src->Key(srcIndex)));
+        src->Key(srcIndex)->~K();
+    }
+
+    /// @brief 내부 노드의 index 위치에 구분 Key를, index + 1 위치에 오른쪽 자식을 삽입
+    static void InsertSeparator(Internal* node, uint64 index, K&& key, BTreeNode* rightChild)
+    {
+        for (uint64 i = node->count; i > index; --i)
+        {
+            MoveKey(node, i, node, i - 1);
+            node->children[i + 1] = node->children[i];
+        }
+        new (node->Key(index)) K(std::move(key));
+        node->children[index + 1] = rightChild;
+        ++node->count;
+    }
+
+    /// @brief 내부 노드에서 index 위치의 구분 Key와 index + 1 위치의 자식을 제거
+    static void RemoveSeparator(Internal* node, uint64 index)
+    {
+        node->Key(index)->~K();
+        for (uint64 i = index; i + 1 < node->count; ++i)
+        {
+            MoveKey(node, i, node, i + 1);
+            node->children[i + 1] = node->children[i + 2];
+        }
+        --node->count;
+    }
+
+    /// @brief 분할에 쓸 내부 노드를 미리 할당해 두는 목록 (쓰지 않은 노드는 소멸 시 해제)
+    struct InternalReserve
+    {
+        explicit InternalReserve(BPlusTree& tree)
+            : tree(tree)
+            , count(0)
+        {
+        }
+
+        ~InternalReserve()
+        {
+            while (count > 0)
+            {
+                tree.FreeInternal(nodes[--count]);
+            }
+        }
+
+        InternalReserve(const InternalReserve&) = delete;
+        InternalReserve& operator=(const InternalReserve&) = delete;
+
+        void Add()
+        {
+            nodes[count] = tree.NewInternal();
+            ++count;
+        }
+
+        Internal* Take()
+        {
+            return nodes[--count];
+        }
+
+        BPlusTree& tree;
+        Internal* nodes[MAX_DEPTH + 1];
+        uint64 count;
+    };
+
+    /// @brief 분할된 노드의 구분 Key와 오른쪽 노드를 부모에 올리고, 부모가 가득 차면 위로 계속 분할
+    /// @param reserve 가득 찬 조상마다 하나, 새 루트가 필요하면 하나 더 미리 할당한 내부 노드 (할당 없음)
+    void InsertIntoParent(PathEntry* path, uint64 depth, BTreeNode* left, K&& separator, BTreeNode* right,
+                          InternalReserve& reserve)
+    {
+        while (depth > 0)
+        {
+            --depth;
+            Internal* parent = path[depth].node;
+            uint64 index = path[depth].index;
+
+            if (parent->count < NODE_CAPACITY)
+            {
+                InsertSeparator(parent, index, std::move(separator), right);
+                return;
+            }
+
+            // 가운데 Key는 위로 올리고, 그 뒤의 Key와 자식은 새 노드로 옮김
+            Internal* sibling = reserve.Take();
+            const uint64 mid = NODE_CAPACITY / 2;
+            K pushUp(std::move(*parent->Key(mid)));
+            parent->Key(mid)->~K();
+            for (uint64 i = mid + 1; i < NODE_CAPACITY; ++i)
+            {
+                MoveKey(sibling, i - mid - 1, parent, i);
+            }
+            for (uint64 i = mid + 1; i <= NODE_CAPACITY; ++i)
+            {
+                sibling->children[i - mid - 1] = parent->children[i];
+            }
+            sibling->count = static_cast<uint32>(NODE_CAPACITY - mid - 1);
+            parent->count = static_cast<uint32>(mid);
+
+            if (index <= mid)
+            {
+                InsertSeparator(parent, index, std::move(separator), right);
+            }
+            else
+            {
+                InsertSeparator(sibling, index - mid - 1, std::move(separator), right);
+            }
+
+            left = parent;
+            right = sibling;
+            separator = std::move(pushUp);
+        }
+
+        Internal* root = reserve.Take();
+        new (root->Key(0)) K(std::move(separator));
+        root->children[0] = left;
+        root->children[1] = right;
+        root->count = 1;
+        m_root = root;
+    }
+
+    /// @brief 최소 개수보다 적어진 리프를 형제에게서 빌리거나 형제와 병합
+    void RebalanceLeaf(Leaf* leaf, const PathEntry& entry)
+    {
+        Internal* parent = entry.node;
+        const uint64 index = entry.index;
+        Leaf* left = (index > 0) ? static_cast<Leaf*>(parent->children[index - 1]) : nullptr;
+        Leaf* right = (index < parent->count) ? static_cast<Leaf*>(parent->children[index + 1]) : nullptr;
+
+        if (left != nullptr && left->count > MIN_LEAF_COUNT)
+        {
+            for (uint64 i = leaf->count; i > 0; --i)
+            {
+                MoveEntry(leaf, i, leaf, i - 1);
+            }
+            MoveEntry(leaf, 0, left, left->count - 1);
+            --left->count;
+            ++leaf->count;
+            *parent->Key(index - 1) = *leaf->Key(0);
+            return;
+        }
+
+        if (right != nullptr && right->count > MIN_LEAF_COUNT)
+        {
+            MoveEntry(leaf, leaf->count, right, 0);
+            ++leaf->count;
+            ShiftLeft(right, 0);
+            --right->count;
+            *parent->Key(index) = *right->Key(0);
+            return;
+        }
+
+        if (left != nullptr)
+        {
+            MergeLeaves(left, leaf);
+            RemoveSeparator(parent, index - 1);
+        }
+        else
+        {
+            MergeLeaves(leaf, right);
+            RemoveSeparator(parent, index);
+        }
+    }
+
+    /// @brief 바로 오른쪽 리프 src의 요소를 dst 뒤에 붙이고 src를 해제
+    void MergeLeaves(Leaf* dst, Leaf* src)
+    {
+        for (uint64 i = 0; i < src->count; ++i)
+        {
+            MoveEntry(dst, dst->count + i, src, i);
+        }
+        dst->count += src->count;
+
+        dst->next = src->next;
+        if (src->next != nullptr)
+        {
+            src->next->prev = dst;
+        }
+        else
+        {
+            m_last = dst;
+        }
+
+        src->count = 0;
+        FreeLeaf(src);
+    }
+
+    /// @brief 경로를 거슬러 올라가며 최소 개수보다 적어진 내부 노드를 정리
+    void RebalanceInternal(PathEntry* path, uint64 depth)
+    {
+        while (true)
+        {
+            Internal* node = path[depth].node;
+
+            if (depth == 0)
+            {
+                // 루트에 자식이 하나만 남으면 그 자식이 새 루트가 됨
+                if (node->count == 0)
+                {
+                    m_root = node->children[0];
+                    FreeInternal(node);
+                }
+                return;
+            }
+
+            if (node->count >= MIN_INTERNAL_COUNT)
+            {
+                return;
+            }
+
+            Internal* parent = path[depth - 1].node;
+            const uint64 index = path[depth - 1].index;
+            Internal* left = (index > 0) ? static_cast<Internal*>(parent->children[index - 1]) : nullptr;
+            Internal* right = (index < parent->count) ? static_cast<Internal*>(parent->children[index + 1]) : nullptr;
+
+            if (left != nullptr && left->count > MIN_INTERNAL_COUNT)
+            {
+                // 부모의 구분 Key를 내려받고, 왼쪽 형제의 마지막 Key를 부모로 올림
+                for (uint64 i = node->count; i > 0; --i)
+                {
+                    MoveKey(node, i, node, i - 1);
+                }
+                for (uint64 i = node->count + 1; i > 0; --i)
+                {
+                    node->children[i] = node->children[i - 1];
+                }
+                new (node->Key(0)) K(std::move(*parent->Key(index - 1)));
+                node->children[0] = left->children[left->count];
+                ++node->count;
+
+                *parent->Key(index - 1) = std::move(*left->Key(left->count - 1));
+                left->Key(left->count - 1)->~K();
+                --left->count;
+                return;
+            }
+
+            if (right != nullptr && right->count > MIN_INTERNAL_COUNT)
+            {
+                // 부모의 구분 Key를 내려받고, 오른쪽 형제의 첫 Key를 부모로 올림
+                new (node->Key(node->count)) K(std::move(*parent->Key(index)));
+                node->children[node->count + 1] = right->children[0];
+                ++node->count;
+
+                *parent->Key(index) = std::move(*right->Key(0));
+                right->Key(0)->~K();
+                for (uint64 i = 0; i + 1 < right->count; ++i)
+                {
+                    MoveKey(right, i, right, i + 1);
+                }
+                for (uint64 i = 0; i < right->count; ++i)
+                {
+                    right->children[i] = right->children[i + 1];
+                }
+                --right->count;
+                return;
+            }
+
+            if (left != nullptr)
+            {
+                MergeInternals(left, parent, index - 1, node);
+            }
+            else
+            {
+                MergeInternals(node, parent, index, right);
+            }
+            --depth;
+        }
+    }
+
+    /// @brief 부모의 구분 Key와 바로 오른쪽 노드 src를 dst 뒤에 붙이고 src를 해제
+    void MergeInternals(Internal* dst, Internal* parent, uint64 separatorIndex, Internal* src)
+    {
+        new (dst->Key(dst->count)) K(std::move(*parent->Key(separatorIndex)));
+        for (uint64 i = 0; i < src->count; ++i)
+        {
+            MoveKey(dst, dst->count + 1 + i, src, i);
+        }
+        for (uint64 i = 0; i <= src->count; ++i)
+        {
+            dst->children[dst->count + 1 + i] = src->children[i];
+        }
+        dst->count += 1 + src->count;
+
+        src->count = 0;
+        FreeInternal(src);
+        RemoveSeparator(parent, separatorIndex);
+    }
+
+    Leaf* NewLeaf()
+    {
+        void* memory = Alloc::Allocate(sizeof(Leaf), alignof(Leaf));
+        return new (memory) Leaf();
+    }
+
+    Internal* NewInternal()
+    {
+        void* memory = Alloc::Allocate(sizeof(Internal), alignof(Internal));
+        return new (memory) Internal();
+    }
+
+    void FreeLeaf(Leaf* leaf)
+    {
+        leaf->~Leaf();
+        Alloc::Deallocate(leaf, sizeof(Leaf), alignof(Leaf));
+    }
+
+    void FreeInternal(Internal* node)
+    {
+        node->~Internal();
+        Alloc::Deallocate(node, sizeof(Internal), alignof(Internal));
+    }
+
+    void DestroyNode(BTreeNode* node)
+    {
+        if (node->isLeaf)
+        {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            for (uint64 i = 0; i < leaf->count; ++i)
+            {
+                DestroyEntry(leaf, i);
+            }
+            FreeLeaf(leaf);
+            return;
+        }
+
+        Internal* internal = static_cast<Internal*>(node);
+        for (uint64 i = 0; i < internal->count; ++i)
+        {
+            internal->Key(i)->~K();
+        }
+        for (uint64 i = 0; i <= internal->count; ++i)
+        {
+            DestroyNode(internal->children[i]);
+        }
+        FreeInternal(internal);
+    }
+
+    /// @brief other의 노드 구조를 그대로 복사 (this는 비어 있어야 함, O(n))
+    /// @note 복사 중 예외가 나면 만든 노드를 모두 해제하고 빈 트리로 남긴 채 다시 던집니다
+    void CopyFrom(const BPlusTree& other)
+    {
+        if (other.m_root == nullptr)
+        {
+            return;
+        }
+
+        Leaf* prevLeaf = nullptr;
+        try
+        {
+            m_root = CopyNode(other.m_root, prevLeaf);
+        }
+        catch (...)
+        {
+            m_first = nullptr;
+            throw;
+        }
+        m_last = prevLeaf;
+        m_size = other.m_size;
+    }
+
+    /// @brief 노드와 그 아래를 복사하고, 복사한 리프는 순서대로 prevLeaf 뒤에 연결
+    BTreeNode* CopyNode(BTreeNode* node, Leaf*& prevLeaf)
+    {
+        if (node->isLeaf)
+        {
+            Leaf* src = static_cast<Leaf*>(node);
+            Leaf* leaf = NewLeaf();
+            try
+            {
+                for (; leaf->count < src->count; ++leaf->count)
+                {
+                    CopyEntry(leaf, src, leaf->count);
+                }
+            }
+            catch (...)
+            {
+                DestroyNode(leaf);
+                throw;
+            }
+
+            leaf->prev = prevLeaf;
+            if (prevLeaf != nullptr)
+            {
+                prevLeaf->next = leaf;
+            }
+            else
+            {
+                m_first = leaf;
+            }
+            prevLeaf = leaf;
+            return leaf;
+        }
+
+        Internal* src = static_cast<Internal*>(node);
+        Internal* internal = NewInternal();
+        uint64 childCount = 0;
+        try
+        {
+            for (; childCount <= src->count; ++childCount)
+            {
+                internal->children[childCount] = CopyNode(src->children[childCount], prevLeaf);
+            }
+            for (; internal->count < src->count; ++internal->count)
+            {
+                new (internal->Key(internal->count)) K(*src->Key(internal->count));
+            }
+        }
+        catch (...)
+        {
+            for (uint64 i = 0; i < internal->count; ++i)
+            {
+                internal->Key(i)->~K();
+            }
+            for (uint64 i = 0; i < childCount; ++i)
+            {
+                DestroyNode(internal->children[i]);
+            }
+            FreeInternal(internal);
+            throw;
+        }
+        return internal;
+    }
+
+    /// @brief src의 index 위치 요소를 dst의 같은 위치에 복사 (Value 복사가 실패하면 Key도 소멸)
+    static void CopyEntry(Leaf* dst, Leaf* src, uint64 index)
+    {
+        new (dst->Key(index)) K(*src->Key(index));
+        try
+        {
+            new (dst->Value(index)) V(*src->Value(index));
+        }
+        catch (...)
+        {
+            dst->Key(index)->~K();
+            throw;
+        }
+    }
+
+    void Swap(BPlusTree& other)
+    {
+        std::swap(m_root, other.m_root);
+        std::swap(m_first, other.m_first);
+        std::swap(m_last, other.m_last);
+        std::swap(m_size, other.m_size);
+        std::swap(static_cast<Alloc&>(*this), static_cast<Alloc&>(other));
+    }
+
+    BTreeNode* m_root;
+    Leaf* m_first;
+    Leaf* m_last;
+    uint64 m_size;
+};
+
+} // namespace Excep
@@ -0,0 +1,56 @@
+﻿#pragma once
+#include "Core/Types.h"
+
+namespace Excep
+{
+
+/// @brief 정렬된 배열에서 key 이상인 첫 번째 요소의 위치를 찾습니다 (분기 없는 이진 탐색)
+/// @param data 정렬된 배열
+/// @param count 요소 개수
+/// @param key 찾을 키
+/// @param less 비교 함수 객체
+/// @return 위치 (모든 요소가 key보다 작으면 count)
+/// @note 반복 횟수가 크기에만 의존하고 비교 결과는 조건부 이동(cmov)으로 처리되어 분기 예측 실패가 없습니다
+template<typename T, typename K, typename Compare>
+uint64 BranchlessLowerBound(const T* data, uint64 count, const K& key, Compare less)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const T* base = data;
+    while (count > 1)
+    {
+        const uint64 half = count / 2;
+        base = less(base[half - 1], key) ? base + half : base;
+        count -= half;
+    }
+    return static_cast<uint64>(base - data) + (less(*base, key) ? 1 : 0);
+}
+
+/// @brief 정렬된 배열에서 key보다 큰 첫 번째 요소의 위치를 찾습니다 (분기 없는 이진 탐색)
+/// @param data 정렬된 배열
+/// @param count 요소 개수
+/// @param key 찾을 키
+/// @param less 비교 함수 객체
+/// @return 위치 (모든 요소가 key 이하이면 count)
+template<typename T, typename K, typename Compare>
+uint64 BranchlessUpperBound(const T* data, uint64 count, const K& key, Compare less)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const T* base = data;
+    while (count > 1)
+    {
+        const uint64 half = count / 2;
+        base = less(key, base[half - 1]) ? base : base + half;
+        count -= half;
+    }
+    return static_cast<uint64>(base - data) + (less(key, *base) ? 0 : 1);
+}
+
+} // namespace Excep
@@ -0,0 +1,388 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+
+namespace Excep
+{
+
+/// @brief 비트 배열의 워드 단위 연산 함수들
+/// @note BitArray와 BitVector가 공유합니다. 모든 함수는 마지막 워드의 사용하지 않는 상위 비트가
+///       0이라고 가정하며, 두 배열을 결합하는 연산은 SSE2로 워드 두 개씩 처리합니다.
+namespace BitWords
+{
+
+constexpr uint64 BITS_PER_WORD = 64;
+
+/// @brief 비트 개수를 담는 데 필요한 워드 개수
+inline constexpr uint64 GetWordCount(uint64 bitCount)
+{
+    return (bitCount + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+/// @brief 마지막 워드에서 실제로 사용하는 비트의 마스크
+inline constexpr uint64 GetLastWordMask(uint64 bitCount)
+{
+    return (bitCount % BITS_PER_WORD == 0) ? ~0ull : ((1ull << (bitCount % BITS_PER_WORD)) - 1);
+}
+
+struct AndOp
+{
+    static uint64 Apply(uint64 lhs, uint64 rhs) { return lhs & rhs; }
+#if EXCEP_SIMD_SSE2
+    static __m128i Apply(__m128i lhs, __m128i rhs) { return _mm_and_si128(lhs, rhs); }
+#endif
+};
+
+struct OrOp
+{
+    static uint64 Apply(uint64 lhs, uint64 rhs) { return lhs | rhs; }
+#if EXCEP_SIMD_SSE2
+    static __m128i Apply(__m128i lhs, __m128i rhs) { return _mm_or_si128(lhs, rhs); }
+#endif
+};
+
+struct XorOp
+{
+    static uint64 Apply(uint64 lhs, uint64 rhs) { return lhs ^ rhs; }
+#if EXCEP_SIMD_SSE2
+    static __m128i Apply(__m128i lhs, __m128i rhs) { return _mm_xor_si128(lhs, rhs); }
+#endif
+};
+
+struct AndNotOp
+{
+    static uint64 Apply(uint64 lhs, uint64 rhs) { return lhs & ~rhs; }
+#if EXCEP_SIMD_SSE2
+    static __m128i Apply(__m128i lhs, __m128i rhs) { return _mm_andnot_si128(rhs, lhs); }
+#endif
+};
+
+/// @brief dst[i] = Op(dst[i], src[i])
+/// @tparam Op AndOp, OrOp, XorOp, AndNotOp 중 하나
+/// @param dst 결과를 받을 워드 배열
+/// @param src 결합할 워드 배열
+/// @param wordCount 워드 개수
+template<typename Op>
+inline void Combine(uint64* dst, const uint64* src, uint64 wordCount)
+{
+    uint64 i = 0;
+#if EXCEP_SIMD_SSE2
+    for (; i + 2 <= wordCount; i += 2)
+    {
+        const __m128i lhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i rhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::Apply(lhs, rhs));
+    }
+#endif
+    for (; i < wordCount; ++i)
+    {
+        dst[i] = Op::Apply(dst[i], src[i]);
+    }
+}
+
+/// @brief 1인 비트의 총 개수
+inline uint64 Count(const uint64* words, uint64 wordCount)
+{
+    uint64 count = 0;
+    for (uint64 i = 0; i < wordCount; ++i)
+    {
+        count += CountSetBits64(words[i]);
+    }
+    return count;
+}
+
+/// @brief 1인 비트가 하나라도 있는지 확인
+inline bool8 Any(const uint64* words, uint64 wordCount)
+{
+    uint64 i = 0;
+#if EXCEP_SIMD_SSE2
+    __m128i combined = _mm_setzero_si128();
+    for (; i + 2 <= wordCount; i += 2)
+    {
+        combined = _mm_or_si128(combined, _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i)));
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(combined, _mm_setzero_si128())) != 0xFFFF)
+    {
+        return true;
+    }
+#endif
+    for (; i < wordCount; ++i)
+    {
+        if (words[i] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief start 위치 이상에서 1인 첫 번째 비트 찾기
+/// @return 비트 인덱스 (없으면 UINT64_MAX)
+inline uint64 FindNext(const uint64* words, uint64 wordCount, uint64 start)
+{
+    uint64 wordIndex = start / BITS_PER_WORD;
+    if (wordIndex >= wordCount)
+    {
+        return UINT64_MAX;
+    }
+
+    // 첫 워드는 start 아래 비트를 가린 뒤 검사하고, 이후로는 0이 아닌 워드를 찾음
+    uint64 word = words[wordIndex] & (~0ull << (start % BITS_PER_WORD));
+    while (word == 0)
+    {
+        if (++wordIndex == wordCount)
+        {
+            return UINT64_MAX;
+        }
+        word = words[wordIndex];
+    }
+    return wordIndex * BITS_PER_WORD + CountTrailingZeros64(word);
+}
+
+/// @brief 1인 모든 비트의 인덱스를 오름차순으로 func에 전달
+template<typename Func>
+inline void ForEachSet(const uint64* words, uint64 wordCount, Func&& func)
+{
+    for (uint64 i = 0; i < wordCount; ++i)
+    {
+        uint64 word = words[i];
+        while (word != 0)
+        {
+            func(i * BITS_PER_WORD + CountTrailingZeros64(word));
+            word &= word - 1;
+        }
+    }
+}
+
+} // namespace BitWords
+
+/// @brief 고정 크기 비트 배열 컨테이너
+/// @tparam N 비트 개수
+/// @note 비트를 64비트 워드에 빽빽하게 저장하므로 bool8 배열보다 메모리와 대역폭이 1/8입니다.
+///       배열 간 AND/OR/XOR/ANDNOT은 SSE2로 처리하고, 1인 비트의 순회는 워드 단위로 건너뜁니다.
+template<uint64 N>
+class BitArray
+{
+public:
+    static constexpr uint64 WORD_COUNT = BitWords::GetWordCount(N);
+
+    /// @brief 기본 생성자 (모든 비트 0)
+    BitArray()
+    {
+        ResetAll();
+    }
+
+    /// @brief 비트를 1로 설정
+    /// @param index 비트 인덱스 (N 미만, 경계 검사 없음)
+    void Set(uint64 index)
+    {
+        m_words[index / BitWords::BITS_PER_WORD] |= GetBitMask(index);
+    }
+
+    /// @brief 비트를 지정한 값으로 설정
+    /// @param index 비트 인덱스 (N 미만, 경계 검사 없음)
+    /// @param value 설정할 값
+    void Set(uint64 index, bool8 value)
+    {
+        if (value)
+        {
+            Set(index);
+        }
+        else
+        {
+            Reset(index);
+        }
+    }
+
+    /// @brief 비트를 0으로 설정
+    /// @param index 비트 인덱스 (N 미만, 경계 검사 없음)
+    void Reset(uint64 index)
+    {
+        m_words[index / BitWords::BITS_PER_WORD] &= ~GetBitMask(index);
+    }
+
+    /// @brief 비트 반전
+    /// @param index 비트 인덱스 (N 미만, 경계 검사 없음)
+    void Flip(uint64 index)
+    {
+        m_words[index / BitWords::BITS_PER_WORD] ^= GetBitMask(index);
+    }
+
+    /// @brief 비트 값 확인
+    /// @param index 비트 인덱스 (N 미만, 경계 검사 없음)
+    /// @return 1이면 true
+    bool8 Test(uint64 index) const
+    {
+        return (m_words[index / BitWords::BITS_PER_WORD] & GetBitMask(index)) != 0;
+    }
+
+    /// @brief 비트 값 확인 (Test와 동일)
+    bool8 operator[](uint64 index) const
+    {
+        return Test(index);
+    }
+
+    /// @brief 모든 비트를 1로 설정
+    void SetAll()
+    {
+        for (uint64 i = 0; i < WORD_COUNT; ++i)
+        {
+            m_words[i] = ~0ull;
+        }
+        m_words[WORD_COUNT - 1] &= BitWords::GetLastWordMask(N);
+    }
+
+    /// @brief 모든 비트를 0으로 설정
+    void ResetAll()
+    {
+        for (uint64 i = 0; i < WORD_COUNT; ++i)
+        {
+            m_words[i] = 0;
+        }
+    }
+
+    /// @brief 모든 비트 반전
+    void FlipAll()
+    {
+        for (uint64 i = 0; i < WORD_COUNT; ++i)
+        {
+            m_words[i] = ~m_words[i];
+        }
+        m_words[WORD_COUNT - 1] &= BitWords::GetLastWordMask(N);
+    }
+
+    /// @brief 1인 비트 개수 반환
+    /// @return 1인 비트 개수
+    uint64 CountSet() const
+    {
+        return BitWords::Count(m_words, WORD_COUNT);
+    }
+
+    /// @brief 1인 비트가 하나라도 있는지 확인
+    bool8 Any() const
+    {
+        return BitWords::Any(m_words, WORD_COUNT);
+    }
+
+    /// @brief 모든 비트가 0인지 확인
+    bool8 None() const
+    {
+        return !Any();
+    }
+
+    /// @brief 모든 비트가 1인지 확인
+    bool8 All() const
+    {
+        return CountSet() == N;
+    }
+
+    /// @brief 1인 첫 번째 비트 찾기
+    /// @return 비트 인덱스 (없으면 UINT64_MAX)
+    uint64 FindFirstSet() const
+    {
+        return BitWords::FindNext(m_words, WORD_COUNT, 0);
+    }
+
+    /// @brief start 이상에서 1인 첫 번째 비트 찾기
+    /// @param start 검색 시작 비트 인덱스
+    /// @return 비트 인덱스 (없으면 UINT64_MAX)
+    uint64 FindNextSet(uint64 start) const
+    {
+        return BitWords::FindNext(m_words, WORD_COUNT, start);
+    }
+
+    /// @brief 1인 모든 비트의 인덱스를 오름차순으로 순회
+    /// @param func uint64 인덱스를 받는 함수 객체
+    template<typename Func>
+    void ForEachSetBit(Func&& func) const
+    {
+        BitWords::ForEachSet(m_words, WORD_COUNT, func);
+    }
+
+    BitArray& operator&=(const BitArray& other)
+    {
+        BitWords::Combine<BitWords::AndOp>(m_words, other.m_words, WORD_COUNT);
+        return *this;
+    }
+
+    BitArray& operator|=(const BitArray& other)
+    {
+        BitWords::Combine<BitWords::OrOp>(m_words, other.m_words, WORD_COUNT);
+        return *this;
+    }
+
+    BitArray& operator^=(const BitArray& other)
+    {
+        BitWords::Combine<BitWords::XorOp>(m_words, other.m_words, WORD_COUNT);
+        return *this;
+    }
+
+    /// @brief other에서 1인 비트를 이 배열에서 0으로 설정 (this &= ~other)
+    /// @param other 지울 비트 배열
+    BitArray& AndNot(const BitArray& other)
+    {
+        BitWords::Combine<BitWords::AndNotOp>(m_words, other.m_words, WORD_COUNT);
+        return *this;
+    }
+
+    BitArray operator&(const BitArray& other) const { BitArray result(*this); return result &= other; }
+    BitArray operator|(const BitArray& other) const { BitArray result(*this); return result |= other; }
+    BitArray operator^(const BitArray& other) const { BitArray result(*this); return result ^= other; }
+
+    bool8 operator==(const BitArray& other) const
+    {
+        for (uint64 i = 0; i < WORD_COUNT; ++i)
+        {
+            if (m_words[i] != other.m_words[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool8 operator!=(const BitArray& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// @brief 비트 개수 반환
+    /// @return N
+    constexpr uint64 GetSize() const
+    {
+        return N;
+    }
+
+    /// @brief 워드 배열 반환
+    /// @return 첫 번째 워드를 가리키는 포인터 (비트 i는 워드 i / 64의 i % 64번째 비트)
+    uint64* GetWords()
+    {
+        return m_words;
+    }
+
+    /// @brief 워드 배열 반환 (const 버전)
+    /// @return 첫 번째 워드를 가리키는 const 포인터
+    const uint64* GetWords() const
+    {
+        return m_words;
+    }
+
+    /// @brief 워드 개수 반환
+    /// @return 워드 개수
+    constexpr uint64 GetWordCount() const
+    {
+        return WORD_COUNT;
+    }
+
+private:
+    static_assert(N > 0, "BitArray size must be greater than 0");
+
+    static uint64 GetBitMask(uint64 index)
+    {
+        return 1ull << (index % BitWords::BITS_PER_WORD);
+    }
+
+    uint64 m_words[WORD_COUNT];
+};
+
+} // namespace Excep
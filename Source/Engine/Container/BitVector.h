@@ -0,0 +1,325 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/BitArray.h"
+#include "Container/DynamicArray.h"
+#include "Memory/Allocator.h"
+
+namespace Excep
+{
+
+/// @brief 크기를 바꿀 수 있는 비트 배열 컨테이너
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note BitArray와 같은 연산을 제공합니다. 오브젝트별 가시성 마스크나 dirty 플래그처럼
+///       크기가 실행 중에 정해지는 플래그 집합에 사용합니다.
+///       두 BitVector를 결합하는 연산은 크기가 같아야 합니다.
+template<typename Alloc = DefaultAllocator>
+class BitVector
+{
+public:
+    /// @brief 기본 생성자 (빈 배열)
+    BitVector()
+        : m_size(0)
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성 (빈 배열)
+    /// @param allocator 사용할 할당자
+    explicit BitVector(const Alloc& allocator)
+        : m_words(allocator)
+        , m_size(0)
+    {
+    }
+
+    /// @brief 크기와 초기값을 지정하여 생성
+    /// @param size 비트 개수
+    /// @param value 모든 비트의 초기값
+    explicit BitVector(uint64 size, bool8 value = false)
+        : m_size(0)
+    {
+        Resize(size, value);
+    }
+
+    /// @brief 비트 개수 변경
+    /// @param size 새 비트 개수
+    /// @param value 늘어난 비트의 초기값
+    void Resize(uint64 size, bool8 value = false)
+    {
+        const uint64 oldSize = m_size;
+        const uint64 fill = value ? ~0ull : 0ull;
+        m_words.Resize(BitWords::GetWordCount(size), fill);
+        m_size = size;
+
+        // 기존 마지막 워드의 남는 비트를 새 값으로 채움
+        if (value && size > oldSize && oldSize % BitWords::BITS_PER_WORD != 0)
+        {
+            m_words[oldSize / BitWords::BITS_PER_WORD] |= ~BitWords::GetLastWordMask(oldSize);
+        }
+        MaskLastWord();
+    }
+
+    /// @brief 끝에 비트 추가
+    /// @param value 추가할 비트 값
+    void Add(bool8 value)
+    {
+        if (m_size % BitWords::BITS_PER_WORD == 0)
+        {
+            m_words.Add(0);
+        }
+        ++m_size;
+        Set(m_size - 1, value);
+    }
+
+    /// @brief 모든 비트 제거 (크기 0)
+    void Clear()
+    {
+        m_words.Clear();
+        m_size = 0;
+    }
+
+    /// @brief 비트 용량 예약
+    /// @param capacity 예약할 비트 개수
+    void Reserve(uint64 capacity)
+    {
+        m_words.Reserve(BitWords::GetWordCount(capacity));
+    }
+
+    /// @brief 비트를 1로 설정
+    /// @param index 비트 인덱스 (GetSize() 미만, 경계 검사 없음)
+    void Set(uint64 index)
+    {
+        m_words[index / BitWords::BITS_PER_WORD] |= GetBitMask(index);
+    }
+
+    /// @brief 비트를 지정한 값으로 설정
+    /// @param index 비트 인덱스 (GetSize() 미만, 경계 검사 없음)
+    /// @param value 설정할 값
+    void Set(uint64 index, bool8 value)
+    {
+        if (value)
+        {
+            Set(index);
+        }
+        else
+        {
+            Reset(index);
+        }
+    }
+
+    /// @brief 비트를 0으로 설정
+    /// @param index 비트 인덱스 (GetSize() 미만, 경계 검사 없음)
+    void Reset(uint64 index)
+    {
+        m_words[index / BitWords::BITS_PER_WORD] &= ~GetBitMask(index);
+    }
+
+    /// @brief 비트 반전
+    /// @param index 비트 인덱스 (GetSize() 미만, 경계 검사 없음)
+    void Flip(uint64 index)
+    {
+        m_words[index / BitWords::BITS_PER_WORD] ^= GetBitMask(index);
+    }
+
+    /// @brief 비트 값 확인
+    /// @param index 비트 인덱스 (GetSize() 미만, 경계 검사 없음)
+    /// @return 1이면 true
+    bool8 Test(uint64 index) const
+    {
+        return (m_words[index / BitWords::BITS_PER_WORD] & GetBitMask(index)) != 0;
+    }
+
+    /// @brief 비트 값 확인 (Test와 동일)
+    bool8 operator[](uint64 index) const
+    {
+        return Test(index);
+    }
+
+    /// @brief 모든 비트를 1로 설정
+    void SetAll()
+    {
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            m_words[i] = ~0ull;
+        }
+        MaskLastWord();
+    }
+
+    /// @brief 모든 비트를 0으로 설정 (크기는 유지)
+    void ResetAll()
+    {
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            m_words[i] = 0;
+        }
+    }
+
+    /// @brief 모든 비트 반전
+    void FlipAll()
+    {
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            m_words[i] = ~m_words[i];
+        }
+        MaskLastWord();
+    }
+
+    /// @brief 1인 비트 개수 반환
+    /// @return 1인 비트 개수
+    uint64 CountSet() const
+    {
+        return BitWords::Count(m_words.GetData(), m_words.GetSize());
+    }
+
+    /// @brief 1인 비트가 하나라도 있는지 확인
+    bool8 Any() const
+    {
+        return BitWords::Any(m_words.GetData(), m_words.GetSize());
+    }
+
+    /// @brief 모든 비트가 0인지 확인
+    bool8 None() const
+    {
+        return !Any();
+    }
+
+    /// @brief 모든 비트가 1인지 확인 (빈 배열이면 true)
+    bool8 All() const
+    {
+        return CountSet() == m_size;
+    }
+
+    /// @brief 1인 첫 번째 비트 찾기
+    /// @return 비트 인덱스 (없으면 UINT64_MAX)
+    uint64 FindFirstSet() const
+    {
+        return BitWords::FindNext(m_words.GetData(), m_words.GetSize(), 0);
+    }
+
+    /// @brief start 이상에서 1인 첫 번째 비트 찾기
+    /// @param start 검색 시작 비트 인덱스
+    /// @return 비트 인덱스 (없으면 UINT64_MAX)
+    uint64 FindNextSet(uint64 start) const
+    {
+        return BitWords::FindNext(m_words.GetData(), m_words.GetSize(), start);
+    }
+
+    /// @brief 1인 모든 비트의 인덱스를 오름차순으로 순회
+    /// @param func uint64 인덱스를 받는 함수 객체
+    template<typename Func>
+    void ForEachSetBit(Func&& func) const
+    {
+        BitWords::ForEachSet(m_words.GetData(), m_words.GetSize(), func);
+    }
+
+    BitVector& operator&=(const BitVector& other)
+    {
+        BitWords::Combine<BitWords::AndOp>(m_words.GetData(), other.m_words.GetData(), m_words.GetSize());
+        return *this;
+    }
+
+    BitVector& operator|=(const BitVector& other)
+    {
+        BitWords::Combine<BitWords::OrOp>(m_words.GetData(), other.m_words.GetData(), m_words.GetSize());
+        return *this;
+    }
+
+    BitVector& operator^=(const BitVector& other)
+    {
+        BitWords::Combine<BitWords::XorOp>(m_words.GetData(), other.m_words.GetData(), m_words.GetSize());
+        return *this;
+    }
+
+    /// @brief other에서 1인 비트를 이 배열에서 0으로 설정 (this &= ~other)
+    /// @param other 지울 비트 배열 (크기가 같아야 함)
+    BitVector& AndNot(const BitVector& other)
+    {
+        BitWords::Combine<BitWords::AndNotOp>(m_words.GetData(), other.m_words.GetData(), m_words.GetSize());
+        return *this;
+    }
+
+    BitVector operator&(const BitVector& other) const { BitVector result(*this); return result &= other; }
+    BitVector operator|(const BitVector& other) const { BitVector result(*this); return result |= other; }
+    BitVector operator^(const BitVector& other) const { BitVector result(*this); return result ^= other; }
+
+    bool8 operator==(const BitVector& other) const
+    {
+        if (m_size != other.m_size)
+        {
+            return false;
+        }
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            if (m_words[i] != other.m_words[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool8 operator!=(const BitVector& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// @brief 비트 개수 반환
+    /// @return 비트 개수
+    uint64 GetSize() const
+    {
+        return m_size;
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비트가 하나도 없으면 true
+    bool8 IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// @brief 워드 배열 반환
+    /// @return 첫 번째 워드를 가리키는 포인터 (비트 i는 워드 i / 64의 i % 64번째 비트)
+    uint64* GetWords()
+    {
+        return m_words.GetData();
+    }
+
+    /// @brief 워드 배열 반환 (const 버전)
+    /// @return 첫 번째 워드를 가리키는 const 포인터
+    const uint64* GetWords() const
+    {
+        return m_words.GetData();
+    }
+
+    /// @brief 워드 개수 반환
+    /// @return 워드 개수
+    uint64 GetWordCount() const
+    {
+        return m_words.GetSize();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 복사본
+    Alloc GetAllocator() const
+    {
+        return m_words.GetAllocator();
+    }
+
+private:
+    static uint64 GetBitMask(uint64 index)
+    {
+        return 1ull << (index % BitWords::BITS_PER_WORD);
+    }
+
+    /// @brief 마지막 워드의 사용하지 않는 상위 비트를 0으로 유지
+    void MaskLastWord()
+    {
+        if (!m_words.IsEmpty())
+        {
+            m_words.GetBack() &= BitWords::GetLastWordMask(m_size);
+        }
+    }
+
+    DynamicArray<uint64, Alloc> m_words;
+    uint64 m_size;
+};
+
+} // namespace Excep
@@ -0,0 +1,282 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include "Core/SharedSpinLock.h"
+#include "Container/FlatHashTable.h"
+#include "Container/Hash.h"
+#include "Memory/Allocator.h"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 여러 스레드가 공유하는 Key-Value 맵 (샤드별 읽기/쓰기 잠금)
+/// @tparam K Key 타입
+/// @tparam V Value 타입 (조회 결과는 복사하여 반환하므로 복사 가능해야 함)
+/// @tparam Hasher 해시 함수 객체 (기본값: Hash<K>)
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @tparam ShardCount 샤드 개수 (2의 거듭제곱)
+/// @note Key의 해시로 샤드를 고르고, 샤드마다 HashMap과 같은 Open Addressing 테이블과 잠금을 따로 둡니다.
+///       조회는 샤드의 읽기 잠금만 잡으며, 읽기 카운트가 스레드 슬롯별 캐시 라인에 있으므로(SharedSpinLockArray)
+///       같은 샤드를 읽는 스레드끼리도 캐시 라인을 다투지 않습니다.
+///       쓰기는 해당 샤드 하나만 잠그므로 다른 샤드의 조회/쓰기와 동시에 진행되지만,
+///       모든 읽기 슬롯을 확인하므로 조회보다 비쌉니다 (읽기가 대부분인 레지스트리용).
+///       해시는 호출마다 한 번만 계산하여 샤드 선택과 테이블 탐색/삽입에 함께 사용합니다.
+///       Visit/ForEach의 함수 안에서 같은 맵을 조회하면 읽기 잠금에 재진입하므로 대기 중인 쓰기와 교착되지 않지만,
+///       쓰기(Insert/Remove/FindOrInsert/Clear)를 호출하면 교착됩니다.
+///       내부 요소의 포인터는 다른 스레드의 삽입으로 언제든 무효화될 수 있으므로 반환하지 않습니다.
+template<typename K, typename V, typename Hasher = Hash<K>, typename Alloc = DefaultAllocator, uint64 ShardCount = 64>
+class ConcurrentHashMap
+{
+private:
+    static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0,
+                  "ConcurrentHashMap ShardCount must be a power of two");
+
+public:
+    using Pair = std::pair<K, V>;
+
+private:
+    using Table = FlatHashTable<K, Pair, PairKeyOf<K, Pair>, Hasher, Alloc>;
+    using LockArray = SharedSpinLockArray<ShardCount>;
+
+    struct Shard
+    {
+        explicit Shard(const Alloc& allocator)
+            : table(allocator)
+        {
+        }
+
+        Table table;
+
+        // 이웃 샤드의 테이블 헤더와 같은 캐시 라인을 쓰지 않도록 분리
+        char8 padding[CACHE_LINE_SIZE];
+    };
+
+public:
+    /// @brief 생성자
+    /// @param allocator 모든 샤드가 사용할 할당자 (스레드 안전해야 함)
+    explicit ConcurrentHashMap(const Alloc& allocator = Alloc())
+    {
+        for (uint64 i = 0; i < ShardCount; ++i)
+        {
+            new (&m_shardStorage[i]) Shard(allocator);
+        }
+    }
+
+    ~ConcurrentHashMap()
+    {
+        for (uint64 i = 0; i < ShardCount; ++i)
+        {
+            GetShardAt(i).~Shard();
+        }
+    }
+
+    // 여러 스레드가 공유하는 잠금을 가지므로 복사/이동 불가
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+    ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+
+    /// @brief Key-Value 쌍 삽입
+    /// @param key 키
+    /// @param value 값
+    /// @return 삽입 성공 시 true, 이미 존재하면 false
+    bool8 Insert(const K& key, const V& value)
+    {
+        const uint64 hash = m_hasher(key);
+        const uint64 index = GetShardIndex(hash);
+        ExclusiveLockGuard<LockArray> guard(m_locks, index);
+        return GetShardAt(index).table.TryEmplace(MakePrehashedKey(key, hash), key, value).second;
+    }
+
+    /// @brief Key의 Value를 반환하고, 없으면 factory로 생성하여 삽입
+    /// @param key 키
+    /// @param factory V를 반환하는 함수 객체 (Key가 없을 때만 쓰기 잠금 안에서 한 번 호출)
+    /// @return 찾았거나 새로 삽입한 Value의 복사본
+    /// @note 먼저 읽기 잠금으로 찾아보므로 이미 있는 Key는 쓰기 잠금을 잡지 않습니다.
+    ///       factory는 샤드를 잠근 채 호출되므로 같은 맵에 다시 접근하면 안 됩니다.
+    template<typename Factory>
+    V FindOrInsert(const K& key, Factory&& factory)
+    {
+        const uint64 hash = m_hasher(key);
+        const uint64 index = GetShardIndex(hash);
+        Shard& shard = GetShardAt(index);
+        {
+            SharedLockGuard<LockArray> guard(m_locks, index);
+            const Pair* pair = shard.table.Find(MakePrehashedKey(key, hash));
+            if (pair != nullptr)
+            {
+                return pair->second;
+            }
+        }
+
+        ExclusiveLockGuard<LockArray> guard(m_locks, index);
+
+        // 잠금을 기다리는 동안 다른 스레드가 삽입했을 수 있음
+        Pair* pair = shard.table.Find(MakePrehashedKey(key, hash));
+        if (pair == nullptr)
+        {
+            pair = shard.table.TryEmplace(MakePrehashedKey(key, hash), key, factory()).first;
+        }
+        return pair->second;
+    }
+
+    /// @brief Key로 요소 제거
+    /// @param key 제거할 키
+    /// @return 제거 성공 시 true, 키가 없으면 false
+    bool8 Remove(const K& key)
+    {
+        return RemoveImpl(key);
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 요소 제거 (Hasher가 is_transparent인 경우)
+    /// @param key 제거할 키 (StringView8, 문자열 리터럴 등)
+    /// @return 제거 성공 시 true, 키가 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 Remove(const Q& key)
+    {
+        return RemoveImpl(key);
+    }
+
+    /// @brief Key로 Value를 찾아 복사
+    /// @param key 찾을 키
+    /// @param outValue 찾은 Value를 받을 변수 (없으면 변경하지 않음)
+    /// @return 찾으면 true, 없으면 false
+    bool8 TryGet(const K& key, V& outValue) const
+    {
+        return Visit(key, [&outValue](const V& value) { outValue = value; });
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 Value를 찾아 복사 (Hasher가 is_transparent인 경우)
+    /// @param key 찾을 키 (StringView8, 문자열 리터럴 등)
+    /// @param outValue 찾은 Value를 받을 변수 (없으면 변경하지 않음)
+    /// @return 찾으면 true, 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 TryGet(const Q& key, V& outValue) const
+    {
+        return Visit(key, [&outValue](const V& value) { outValue = value; });
+    }
+
+    /// @brief Key 존재 여부 확인
+    /// @param key 확인할 키
+    /// @return 존재하면 true, 없으면 false
+    bool8 Contains(const K& key) const
+    {
+        return Visit(key, [](const V&) {});
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 존재 여부 확인 (Hasher가 is_transparent인 경우)
+    /// @param key 확인할 키 (StringView8, 문자열 리터럴 등)
+    /// @return 존재하면 true, 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 Contains(const Q& key) const
+    {
+        return Visit(key, [](const V&) {});
+    }
+
+    /// @brief Key의 Value를 읽기 잠금 안에서 함수에 전달 (복사 없이 읽기)
+    /// @param key 찾을 키 (K 또는 Hasher가 is_transparent이면 K와 비교 가능한 타입)
+    /// @param func const V&를 받는 함수 객체 (같은 맵의 조회는 가능하지만 쓰기 접근하면 안 됨)
+    /// @return 찾으면 true, 없으면 false
+    template<typename Q, typename Func>
+    bool8 Visit(const Q& key, Func&& func) const
+    {
+        const uint64 hash = m_hasher(key);
+        const uint64 index = GetShardIndex(hash);
+        SharedLockGuard<LockArray> guard(m_locks, index);
+        const Pair* pair = GetShardAt(index).table.Find(MakePrehashedKey(key, hash));
+        if (pair == nullptr)
+        {
+            return false;
+        }
+
+        func(pair->second);
+        return true;
+    }
+
+    /// @brief 모든 요소를 샤드 순서대로 함수에 전달
+    /// @param func (const K&, const V&)를 받는 함수 객체 (같은 맵의 조회는 가능하지만 쓰기 접근하면 안 됨)
+    /// @note 샤드 하나씩 읽기 잠금을 잡으므로 전체의 일관된 스냅샷은 아닙니다
+    template<typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (uint64 i = 0; i < ShardCount; ++i)
+        {
+            SharedLockGuard<LockArray> guard(m_locks, i);
+            const Table& table = GetShardAt(i).table;
+            for (typename Table::ConstIterator it = table.Begin(); it != table.End(); ++it)
+            {
+                func(it->first, it->second);
+            }
+        }
+    }
+
+    /// @brief 모든 요소 제거
+    void Clear()
+    {
+        for (uint64 i = 0; i < ShardCount; ++i)
+        {
+            ExclusiveLockGuard<LockArray> guard(m_locks, i);
+            GetShardAt(i).table.Clear();
+        }
+    }
+
+    /// @brief 요소 개수 반환
+    /// @return 요소 개수 (다른 스레드가 동시에 수정 중이면 근사값)
+    uint64 GetSize() const
+    {
+        uint64 size = 0;
+        for (uint64 i = 0; i < ShardCount; ++i)
+        {
+            SharedLockGuard<LockArray> guard(m_locks, i);
+            size += GetShardAt(i).table.GetSize();
+        }
+        return size;
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true (다른 스레드가 동시에 수정 중이면 근사값)
+    bool8 IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+    /// @brief 샤드 개수 반환
+    /// @return 샤드 개수
+    static constexpr uint64 GetShardCount()
+    {
+        return ShardCount;
+    }
+
+private:
+    /// @brief 해시의 상위 비트로 샤드 선택 (하위 비트는 샤드 안의 테이블 탐색에 사용됨)
+    static uint64 GetShardIndex(uint64 hash)
+    {
+        return (MixHash(hash) >> 32) & (ShardCount - 1);
+    }
+
+    template<typename Q>
+    bool8 RemoveImpl(const Q& key)
+    {
+        const uint64 hash = m_hasher(key);
+        const uint64 index = GetShardIndex(hash);
+        ExclusiveLockGuard<LockArray> guard(m_locks, index);
+        return GetShardAt(index).table.Remove(MakePrehashedKey(key, hash));
+    }
+
+    Shard& GetShardAt(uint64 index) const
+    {
+        return *reinterpret_cast<Shard*>(&m_shardStorage[index]);
+    }
+
+    // 할당자를 전달하여 생성하기 위해 원시 저장소에 배치
+    mutable typename std::aligned_storage<sizeof(Shard), alignof(Shard)>::type m_shardStorage[ShardCount];
+
+    // 읽기 경로도 잠금 상태를 바꾸므로 mutable
+    mutable LockArray m_locks;
+    Hasher m_hasher;
+};
+
+} // namespace Excep
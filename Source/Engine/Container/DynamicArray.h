@@ -1,25 +1,39 @@
 ﻿#pragma once
 #include "Core/Types.h"
+#include "Memory/Allocator.h"
 #include <vector>
 #include <initializer_list>
+#include <iterator>
+#include <utility>
 
 namespace Excep
 {
 
 /// @brief std::vector를 래핑한 동적 배열 컨테이너
 /// @tparam T 저장할 요소의 타입
-template<typename T>
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+template<typename T, typename Alloc = DefaultAllocator>
 class DynamicArray
 {
+private:
+    using StorageType = std::vector<T, StdAllocator<T, Alloc>>;
+
 public:
-    using Iterator = typename std::vector<T>::iterator;
-    using ConstIterator = typename std::vector<T>::const_iterator;
+    using Iterator = typename StorageType::iterator;
+    using ConstIterator = typename StorageType::const_iterator;
 
     /// @brief 기본 생성자
     DynamicArray()
     {
     }
 
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit DynamicArray(const Alloc& allocator)
+        : m_data(StdAllocator<T, Alloc>(allocator))
+    {
+    }
+
     /// @brief 크기를 지정하여 생성
     /// @param size 초기 크기
     explicit DynamicArray(uint64 size)
@@ -56,6 +70,42 @@ public:
         m_data.push_back(std::move(value));
     }
 
+    /// @brief 범위의 모든 요소를 배열 끝에 복사하여 추가
+    /// @param range begin/end로 순회 가능한 범위 (Keys(), Values(), Items() 등)
+    template<typename Range>
+    void AddRange(const Range& range)
+    {
+        using std::begin;
+        using std::end;
+        m_data.insert(m_data.end(), begin(range), end(range));
+    }
+
+    /// @brief 배열 끝에 요소를 제자리 생성
+    /// @param args 요소 생성자 인자
+    /// @return 생성된 요소의 참조
+    template<typename... Args>
+    T& Emplace(Args&&... args)
+    {
+        m_data.emplace_back(std::forward<Args>(args)...);
+        return m_data.back();
+    }
+
+    /// @brief 특정 인덱스에 요소 삽입 (뒤의 요소들은 한 칸씩 밀림)
+    /// @param index 삽입할 위치 (GetSize() 이하)
+    /// @param value 삽입할 요소
+    void InsertAt(uint64 index, const T& value)
+    {
+        m_data.insert(m_data.begin() + index, value);
+    }
+
+    /// @brief 특정 인덱스에 요소 삽입 (move semantics)
+    /// @param index 삽입할 위치 (GetSize() 이하)
+    /// @param value 삽입할 요소
+    void InsertAt(uint64 index, T&& value)
+    {
+        m_data.insert(m_data.begin() + index, std::move(value));
+    }
+
     /// @brief 특정 값을 가진 첫 번째 요소 제거
     /// @param value 제거할 값
     /// @return 제거 성공 시 true, 값을 찾지 못한 경우 false
@@ -227,6 +277,13 @@ public:
         return m_data.end();
     }
 
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 복사본
+    Alloc GetAllocator() const
+    {
+        return m_data.get_allocator().GetAllocator();
+    }
+
     // Range-based for loop 지원
     Iterator begin() { return m_data.begin(); }
     ConstIterator begin() const { return m_data.begin(); }
@@ -234,7 +291,7 @@ public:
     ConstIterator end() const { return m_data.end(); }
 
 private:
-    std::vector<T> m_data;
+    StorageType m_data;
 };
 
 } // namespace Excep
@@ -0,0 +1,718 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include "Container/Hash.h"
+#include "Memory/Allocator.h"
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 컨트롤 바이트 16개를 한 번에 검사하는 프로브 그룹 (SwissTable 방식)
+/// @note 컨트롤 바이트: 0x00~0x7F = 사용 중(H2 해시 7비트), 0x80 = 비어있음, 0xFE = 삭제됨(tombstone)
+class HashGroup
+{
+public:
+    static constexpr uint64 WIDTH = 16;
+    static constexpr uint8 CTRL_EMPTY = 0x80;
+    static constexpr uint8 CTRL_DELETED = 0xFE;
+
+    /// @brief 컨트롤 바이트 16개를 읽어 그룹 생성
+    /// @param ctrl 그룹의 첫 번째 컨트롤 바이트
+    explicit HashGroup(const uint8* ctrl)
+    {
+#if EXCEP_SIMD_SSE2
+        m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        std::memcpy(m_ctrl, ctrl, WIDTH);
+#endif
+    }
+
+    /// @brief H2 값이 일치하는 슬롯들의 비트마스크 반환
+    /// @param h2 찾을 H2 해시 (7비트)
+    /// @return i번째 비트가 1이면 i번째 슬롯이 일치
+    uint32 Match(uint8 h2) const
+    {
+#if EXCEP_SIMD_SSE2
+        __m128i pattern = _mm_set1_epi8(static_cast<char>(h2));
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(pattern, m_ctrl)));
+#else
+        uint32 mask = 0;
+        for (uint32 i = 0; i < WIDTH; ++i)
+        {
+            mask |= static_cast<uint32>(m_ctrl[i] == h2) << i;
+        }
+        return mask;
+#endif
+    }
+
+    /// @brief 비어있는 슬롯들의 비트마스크 반환
+    /// @return i번째 비트가 1이면 i번째 슬롯이 비어있음
+    uint32 MatchEmpty() const
+    {
+        return Match(CTRL_EMPTY);
+    }
+
+    /// @brief 비어있거나 삭제된 슬롯들의 비트마스크 반환
+    /// @return i번째 비트가 1이면 i번째 슬롯에 삽입 가능
+    uint32 MatchEmptyOrDeleted() const
+    {
+#if EXCEP_SIMD_SSE2
+        // EMPTY(0x80)와 DELETED(0xFE)만 최상위 비트가 1
+        return static_cast<uint32>(_mm_movemask_epi8(m_ctrl));
+#else
+        uint32 mask = 0;
+        for (uint32 i = 0; i < WIDTH; ++i)
+        {
+            mask |= static_cast<uint32>(m_ctrl[i] >> 7) << i;
+        }
+        return mask;
+#endif
+    }
+
+    /// @brief 컨트롤 바이트가 사용 중인 슬롯을 나타내는지 확인
+    /// @param ctrl 컨트롤 바이트
+    /// @return 사용 중이면 true
+    static bool8 IsFull(uint8 ctrl)
+    {
+        return (ctrl & 0x80) == 0;
+    }
+
+private:
+#if EXCEP_SIMD_SSE2
+    __m128i m_ctrl;
+#else
+    uint8 m_ctrl[WIDTH];
+#endif
+};
+
+/// @brief FlatHashTable의 순방향 반복자 (사용 중인 슬롯만 순회)
+/// @tparam SlotT 슬롯 타입 (const 가능)
+template<typename SlotT>
+class FlatHashIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<SlotT>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = SlotT*;
+    using reference = SlotT&;
+
+    FlatHashIterator()
+        : m_ctrl(nullptr)
+        , m_slot(nullptr)
+        , m_ctrlEnd(nullptr)
+    {
+    }
+
+    FlatHashIterator(const uint8* ctrl, SlotT* slot, const uint8* ctrlEnd)
+        : m_ctrl(ctrl)
+        , m_slot(slot)
+        , m_ctrlEnd(ctrlEnd)
+    {
+        SkipUnused();
+    }
+
+    /// @brief 비 const 반복자에서 const 반복자로 변환
+    template<typename OtherSlotT,
+             typename = typename std::enable_if<std::is_same<const OtherSlotT, SlotT>::value>::type>
+    FlatHashIterator(const FlatHashIterator<OtherSlotT>& other)
+        : m_ctrl(other.m_ctrl)
+        , m_slot(other.m_slot)
+        , m_ctrlEnd(other.m_ctrlEnd)
+    {
+    }
+
+    SlotT& operator*() const { return *m_slot; }
+    SlotT* operator->() const { return m_slot; }
+
+    FlatHashIterator& operator++()
+    {
+        ++m_ctrl;
+        ++m_slot;
+        SkipUnused();
+        return *this;
+    }
+
+    FlatHashIterator operator++(int)
+    {
+        FlatHashIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    bool8 operator==(const FlatHashIterator& other) const { return m_slot == other.m_slot; }
+    bool8 operator!=(const FlatHashIterator& other) const { return m_slot != other.m_slot; }
+
+private:
+    void SkipUnused()
+    {
+        while (m_ctrl != m_ctrlEnd && !HashGroup::IsFull(*m_ctrl))
+        {
+            ++m_ctrl;
+            ++m_slot;
+        }
+    }
+
+    const uint8* m_ctrl;
+    SlotT* m_slot;
+    const uint8* m_ctrlEnd;
+
+    template<typename OtherSlotT>
+    friend class FlatHashIterator;
+};
+
+/// @brief std::pair 슬롯에서 Key를 꺼내는 정책 (HashMap용)
+template<typename K, typename Pair>
+struct PairKeyOf
+{
+    static const K& Get(const Pair& pair) { return pair.first; }
+};
+
+/// @brief 슬롯 자체가 Key인 정책 (HashSet용)
+template<typename T>
+struct IdentityKeyOf
+{
+    static const T& Get(const T& value) { return value; }
+};
+
+/// @brief 컨트롤 바이트 기반 Open Addressing 해시 테이블 (SwissTable 방식)
+/// @tparam K Key 타입
+/// @tparam Slot 실제로 저장되는 요소 타입
+/// @tparam KeyOf 슬롯에서 Key를 꺼내는 정책 (static const K& Get(const Slot&))
+/// @tparam Hasher 해시 함수 객체
+/// @tparam Alloc 엔진 할당자 타입 (빈 타입이면 EBO로 크기 비용 없음)
+/// @note 슬롯과 컨트롤 바이트는 하나의 연속된 메모리 블록에 저장되며, 프로브는 16개 단위 그룹으로 진행됩니다.
+///       재해시가 일어나면 기존 포인터와 반복자는 모두 무효화됩니다.
+template<typename K, typename Slot, typename KeyOf, typename Hasher, typename Alloc>
+class FlatHashTable : private Alloc
+{
+public:
+    using Iterator = FlatHashIterator<Slot>;
+    using ConstIterator = FlatHashIterator<const Slot>;
+
+    static constexpr float32 DEFAULT_MAX_LOAD_FACTOR = 0.875f;
+    static constexpr float32 MIN_MAX_LOAD_FACTOR = 0.25f;
+    static constexpr float32 MAX_MAX_LOAD_FACTOR = 0.9375f;
+
+    FlatHashTable()
+        : m_ctrl(nullptr)
+        , m_slots(nullptr)
+        , m_capacity(0)
+        , m_size(0)
+        , m_growthLeft(0)
+        , m_maxLoadFactor(DEFAULT_MAX_LOAD_FACTOR)
+    {
+    }
+
+    explicit FlatHashTable(const Alloc& allocator)
+        : Alloc(allocator)
+        , m_ctrl(nullptr)
+        , m_slots(nullptr)
+        , m_capacity(0)
+        , m_size(0)
+        , m_growthLeft(0)
+        , m_maxLoadFactor(DEFAULT_MAX_LOAD_FACTOR)
+    {
+    }
+
+    FlatHashTable(const FlatHashTable& other)
+        : FlatHashTable(other.GetAllocator())
+    {
+        CopyFrom(other);
+    }
+
+    FlatHashTable(FlatHashTable&& other) noexcept
+        : FlatHashTable(other.GetAllocator())
+    {
+        Swap(other);
+    }
+
+    ~FlatHashTable()
+    {
+        DestroyAll();
+        ReleaseSlots();
+    }
+
+    FlatHashTable& operator=(const FlatHashTable& other)
+    {
+        if (this != &other)
+        {
+            DestroyAll();
+            ReleaseSlots();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept
+    {
+        if (this != &other)
+        {
+            DestroyAll();
+            ReleaseSlots();
+            Swap(other);
+        }
+        return *this;
+    }
+
+    /// @brief Key에 해당하는 슬롯 찾기
+    /// @param key 찾을 키 (K, Hasher와 ==가 지원하는 다른 타입, 또는 PrehashedKey)
+    /// @return 슬롯 포인터 (없으면 nullptr)
+    template<typename Q>
+    Slot* Find(const Q& key) const
+    {
+        uint64 index = FindIndex(LookupKey(key), HashOf(key));
+        return (index != NPOS) ? (m_slots + index) : nullptr;
+    }
+
+    /// @brief 여러 Key의 존재 여부를 한 번에 확인
+    /// @param keys 확인할 키 배열
+    /// @param count 키 개수
+    /// @param outResults 결과 배열 (count개, i번째 키가 있으면 true)
+    /// @note 일정 개수씩 해시를 먼저 계산하고 첫 프로브 그룹을 프리페치한 뒤 탐색하여 캐시 미스를 겹칩니다
+    void ContainsMany(const K* keys, uint64 count, bool8* outResults) const
+    {
+        const uint64 BATCH_SIZE = 16;
+        uint64 hashes[BATCH_SIZE];
+
+        for (uint64 start = 0; start < count; start += BATCH_SIZE)
+        {
+            const uint64 batchCount = (count - start < BATCH_SIZE) ? (count - start) : BATCH_SIZE;
+
+            if (m_size == 0)
+            {
+                for (uint64 i = 0; i < batchCount; ++i)
+                {
+                    outResults[start + i] = false;
+                }
+                continue;
+            }
+
+            for (uint64 i = 0; i < batchCount; ++i)
+            {
+                hashes[i] = HashOf(keys[start + i]);
+                const uint64 base = FirstGroup(hashes[i]) * HashGroup::WIDTH;
+                Prefetch(m_ctrl + base);
+                Prefetch(m_slots + base);
+            }
+
+            for (uint64 i = 0; i < batchCount; ++i)
+            {
+                outResults[start + i] = FindIndex(keys[start + i], hashes[i]) != NPOS;
+            }
+        }
+    }
+
+    /// @brief Key가 없을 때만 슬롯을 생성하여 삽입
+    /// @param key 키 (슬롯 생성 전 탐색에만 사용)
+    /// @param args 슬롯 생성자 인자들
+    /// @return (슬롯 포인터, 새로 삽입되었으면 true)
+    template<typename... Args>
+    std::pair<Slot*, bool8> TryEmplace(const K& key, Args&&... args)
+    {
+        return TryEmplaceHashed(key, HashOf(key), std::forward<Args>(args)...);
+    }
+
+    /// @brief 해시를 미리 계산한 Key가 없을 때만 슬롯을 생성하여 삽입
+    /// @param key 해시를 함께 담은 키 (MakePrehashedKey로 생성, 슬롯 생성 전 탐색에만 사용)
+    /// @param args 슬롯 생성자 인자들
+    /// @return (슬롯 포인터, 새로 삽입되었으면 true)
+    template<typename... Args>
+    std::pair<Slot*, bool8> TryEmplace(const PrehashedKey<K>& key, Args&&... args)
+    {
+        return TryEmplaceHashed(key.key, HashOf(key), std::forward<Args>(args)...);
+    }
+
+    /// @brief Key로 슬롯 제거
+    /// @param key 제거할 키 (K, Hasher와 ==가 지원하는 다른 타입, 또는 PrehashedKey)
+    /// @return 제거 성공 시 true
+    template<typename Q>
+    bool8 Remove(const Q& key)
+    {
+        uint64 index = FindIndex(LookupKey(key), HashOf(key));
+        if (index == NPOS)
+        {
+            return false;
+        }
+
+        EraseAt(index);
+        return true;
+    }
+
+    /// @brief 모든 슬롯 제거 (용량은 유지)
+    void Clear()
+    {
+        DestroyAll();
+        if (m_capacity > 0)
+        {
+            std::memset(m_ctrl, HashGroup::CTRL_EMPTY, m_capacity);
+        }
+        m_size = 0;
+        m_growthLeft = GrowthBudget(m_capacity);
+    }
+
+    /// @brief 최소 count개의 요소를 재해시 없이 담을 수 있도록 용량 예약
+    /// @param count 예약할 요소 개수
+    void Reserve(uint64 count)
+    {
+        uint64 required = CapacityFor(count);
+        if (required > m_capacity)
+        {
+            Rehash(required);
+        }
+    }
+
+    /// @brief 최대 부하율 설정 (tombstone 포함)
+    /// @param loadFactor 0.25 ~ 0.9375 범위로 제한됨
+    void SetMaxLoadFactor(float32 loadFactor)
+    {
+        if (loadFactor < MIN_MAX_LOAD_FACTOR)
+        {
+            loadFactor = MIN_MAX_LOAD_FACTOR;
+        }
+        if (loadFactor > MAX_MAX_LOAD_FACTOR)
+        {
+            loadFactor = MAX_MAX_LOAD_FACTOR;
+        }
+        m_maxLoadFactor = loadFactor;
+
+        // 새 부하율에 맞게 tombstone을 정리하며 다시 배치
+        if (m_capacity > 0)
+        {
+            uint64 required = CapacityFor(m_size);
+            Rehash(required > m_capacity ? required : m_capacity);
+        }
+    }
+
+    const Alloc& GetAllocator() const { return *this; }
+    float32 GetMaxLoadFactor() const { return m_maxLoadFactor; }
+    uint64 GetSize() const { return m_size; }
+    uint64 GetCapacity() const { return m_capacity; }
+
+    Iterator Begin() { return Iterator(m_ctrl, m_slots, m_ctrl + m_capacity); }
+    ConstIterator Begin() const { return ConstIterator(m_ctrl, m_slots, m_ctrl + m_capacity); }
+    Iterator End() { return Iterator(m_ctrl + m_capacity, m_slots + m_capacity, m_ctrl + m_capacity); }
+    ConstIterator End() const { return ConstIterator(m_ctrl + m_capacity, m_slots + m_capacity, m_ctrl + m_capacity); }
+
+private:
+    static constexpr uint64 NPOS = ~0ull;
+
+    static uint8 H2(uint64 hash)
+    {
+        return static_cast<uint8>(hash & 0x7F);
+    }
+
+    /// @brief 섞은 해시(HashOf 결과)로 Key를 찾고, 없으면 슬롯을 생성하여 삽입
+    template<typename... Args>
+    std::pair<Slot*, bool8> TryEmplaceHashed(const K& key, uint64 hash, Args&&... args)
+    {
+        uint64 index = FindIndex(key, hash);
+        if (index != NPOS)
+        {
+            return std::pair<Slot*, bool8>(m_slots + index, false);
+        }
+
+        index = PrepareInsert(hash);
+        new (m_slots + index) Slot(std::forward<Args>(args)...);
+        CommitInsert(index, hash);
+        return std::pair<Slot*, bool8>(m_slots + index, true);
+    }
+
+    template<typename Q>
+    uint64 HashOf(const Q& key) const
+    {
+        return MixHash(m_hasher(key));
+    }
+
+    template<typename Q>
+    static uint64 HashOf(const PrehashedKey<Q>& key)
+    {
+        return MixHash(key.hash);
+    }
+
+    template<typename Q>
+    static const Q& LookupKey(const Q& key)
+    {
+        return key;
+    }
+
+    template<typename Q>
+    static const Q& LookupKey(const PrehashedKey<Q>& key)
+    {
+        return key.key;
+    }
+
+    /// @brief 그룹 단위 삼각수 프로브의 시작 그룹 인덱스
+    uint64 FirstGroup(uint64 hash) const
+    {
+        return (hash >> 7) & (m_capacity / HashGroup::WIDTH - 1);
+    }
+
+    template<typename Q>
+    uint64 FindIndex(const Q& key, uint64 hash) const
+    {
+        if (m_size == 0)
+        {
+            return NPOS;
+        }
+
+        const uint64 groupMask = m_capacity / HashGroup::WIDTH - 1;
+        const uint8 h2 = H2(hash);
+        uint64 group = FirstGroup(hash);
+
+        for (uint64 step = 1; ; ++step)
+        {
+            const uint64 base = group * HashGroup::WIDTH;
+            HashGroup probe(m_ctrl + base);
+
+            uint32 match = probe.Match(h2);
+            while (match != 0)
+            {
+                uint64 index = base + CountTrailingZeros32(match);
+                if (KeyOf::Get(m_slots[index]) == key)
+                {
+                    return index;
+                }
+                match &= match - 1;
+            }
+
+            // 빈 슬롯이 있는 그룹에서 프로브 종료
+            if (probe.MatchEmpty() != 0)
+            {
+                return NPOS;
+            }
+
+            group = (group + step) & groupMask;
+        }
+    }
+
+    uint64 FindFirstNonFull(uint64 hash) const
+    {
+        const uint64 groupMask = m_capacity / HashGroup::WIDTH - 1;
+        uint64 group = FirstGroup(hash);
+
+        for (uint64 step = 1; ; ++step)
+        {
+            const uint64 base = group * HashGroup::WIDTH;
+            uint32 mask = HashGroup(m_ctrl + base).MatchEmptyOrDeleted();
+            if (mask != 0)
+            {
+                return base + CountTrailingZeros32(mask);
+            }
+
+            group = (group + step) & groupMask;
+        }
+    }
+
+    uint64 PrepareInsert(uint64 hash)
+    {
+        if (m_growthLeft == 0)
+        {
+            GrowOrCompact();
+        }
+        return FindFirstNonFull(hash);
+    }
+
+    void CommitInsert(uint64 index, uint64 hash)
+    {
+        // tombstone 재사용은 성장 여유분을 소모하지 않음
+        if (m_ctrl[index] == HashGroup::CTRL_EMPTY)
+        {
+            --m_growthLeft;
+        }
+        m_ctrl[index] = H2(hash);
+        ++m_size;
+    }
+
+    void EraseAt(uint64 index)
+    {
+        m_slots[index].~Slot();
+        --m_size;
+
+        // 그룹에 이미 빈 슬롯이 있으면 이 그룹을 지나쳐 간 프로브가 없으므로 EMPTY로 되돌릴 수 있음
+        const uint64 base = index & ~(HashGroup::WIDTH - 1);
+        if (HashGroup(m_ctrl + base).MatchEmpty() != 0)
+        {
+            m_ctrl[index] = HashGroup::CTRL_EMPTY;
+            ++m_growthLeft;
+        }
+        else
+        {
+            m_ctrl[index] = HashGroup::CTRL_DELETED;
+        }
+    }
+
+    /// @brief 성장 여유분이 없을 때 호출: tombstone이 많으면 같은 용량으로 정리, 아니면 2배 확장
+    void GrowOrCompact()
+    {
+        if (m_capacity == 0)
+        {
+            Rehash(HashGroup::WIDTH);
+            return;
+        }
+
+        // m_growthLeft == 0 이므로 budget - size = tombstone 개수
+        const uint64 budget = GrowthBudget(m_capacity);
+        if (m_size <= budget / 2)
+        {
+            Rehash(m_capacity);
+        }
+        else
+        {
+            Rehash(m_capacity * 2);
+        }
+    }
+
+    uint64 GrowthBudget(uint64 capacity) const
+    {
+        if (capacity == 0)
+        {
+            return 0;
+        }
+
+        uint64 budget = static_cast<uint64>(static_cast<float64>(capacity) * m_maxLoadFactor);
+        return (budget < capacity) ? budget : capacity - 1;
+    }
+
+    uint64 CapacityFor(uint64 count) const
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        uint64 capacity = NextPowerOfTwo(static_cast<uint64>(static_cast<float64>(count) / m_maxLoadFactor) + 1);
+        if (capacity < HashGroup::WIDTH)
+        {
+            capacity = HashGroup::WIDTH;
+        }
+        while (GrowthBudget(capacity) < count)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    void Rehash(uint64 newCapacity)
+    {
+        uint8* oldCtrl = m_ctrl;
+        Slot* oldSlots = m_slots;
+        uint64 oldCapacity = m_capacity;
+
+        AllocateSlots(newCapacity);
+
+        for (uint64 i = 0; i < oldCapacity; ++i)
+        {
+            if (HashGroup::IsFull(oldCtrl[i]))
+            {
+                uint64 hash = HashOf(KeyOf::Get(oldSlots[i]));
+                uint64 index = FindFirstNonFull(hash);
+                new (m_slots + index) Slot(std::move(oldSlots[i]));
+                oldSlots[i].~Slot();
+                m_ctrl[index] = H2(hash);
+            }
+        }
+
+        m_growthLeft = GrowthBudget(m_capacity) - m_size;
+        FreeBlock(oldSlots, oldCapacity);
+    }
+
+    /// @brief 슬롯 배열 뒤에 컨트롤 바이트를 붙인 단일 블록 할당
+    void AllocateSlots(uint64 capacity)
+    {
+        void* block = Alloc::Allocate(BlockSize(capacity), alignof(Slot));
+        m_slots = static_cast<Slot*>(block);
+        m_ctrl = reinterpret_cast<uint8*>(m_slots + capacity);
+        m_capacity = capacity;
+        std::memset(m_ctrl, HashGroup::CTRL_EMPTY, capacity);
+    }
+
+    void ReleaseSlots()
+    {
+        FreeBlock(m_slots, m_capacity);
+        m_ctrl = nullptr;
+        m_slots = nullptr;
+        m_capacity = 0;
+        m_size = 0;
+        m_growthLeft = 0;
+    }
+
+    static uint64 BlockSize(uint64 capacity)
+    {
+        return capacity * sizeof(Slot) + capacity;
+    }
+
+    void FreeBlock(Slot* slots, uint64 capacity)
+    {
+        if (slots != nullptr)
+        {
+            Alloc::Deallocate(slots, BlockSize(capacity), alignof(Slot));
+        }
+    }
+
+    void DestroyAll()
+    {
+        for (uint64 i = 0; i < m_capacity; ++i)
+        {
+            if (HashGroup::IsFull(m_ctrl[i]))
+            {
+                m_slots[i].~Slot();
+            }
+        }
+    }
+
+    void CopyFrom(const FlatHashTable& other)
+    {
+        m_maxLoadFactor = other.m_maxLoadFactor;
+        m_hasher = other.m_hasher;
+        if (other.m_capacity == 0)
+        {
+            return;
+        }
+
+        // 같은 용량과 해시 함수이므로 프로브 순서가 동일하여 같은 위치에 그대로 복사 가능
+        AllocateSlots(other.m_capacity);
+        for (uint64 i = 0; i < m_capacity; ++i)
+        {
+            if (HashGroup::IsFull(other.m_ctrl[i]))
+            {
+                new (m_slots + i) Slot(other.m_slots[i]);
+                m_ctrl[i] = other.m_ctrl[i];
+                ++m_size;
+            }
+            else if (other.m_ctrl[i] == HashGroup::CTRL_DELETED)
+            {
+                m_ctrl[i] = HashGroup::CTRL_DELETED;
+            }
+        }
+        m_growthLeft = other.m_growthLeft;
+    }
+
+    void Swap(FlatHashTable& other)
+    {
+        std::swap(m_ctrl, other.m_ctrl);
+        std::swap(m_slots, other.m_slots);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_size, other.m_size);
+        std::swap(m_growthLeft, other.m_growthLeft);
+        std::swap(m_maxLoadFactor, other.m_maxLoadFactor);
+        std::swap(m_hasher, other.m_hasher);
+        std::swap(static_cast<Alloc&>(*this), static_cast<Alloc&>(other));
+    }
+
+    uint8* m_ctrl;
+    Slot* m_slots;
+    uint64 m_capacity;
+    uint64 m_size;
+    uint64 m_growthLeft;
+    float32 m_maxLoadFactor;
+    Hasher m_hasher;
+};
+
+} // namespace Excep
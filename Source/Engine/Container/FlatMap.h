@@ -0,0 +1,566 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/BinarySearch.h"
+#include "Container/DynamicArray.h"
+#include "Container/IteratorRange.h"
+#include "Memory/Allocator.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief FlatMap의 임의 접근 반복자 (Key 배열과 Value 배열을 나란히 순회)
+/// @tparam K Key 타입
+/// @tparam V Value 타입
+/// @tparam IS_CONST const 반복자 여부
+template<typename K, typename V, bool8 IS_CONST>
+class FlatMapIterator
+{
+private:
+    using ValuePtr = typename std::conditional<IS_CONST, const V*, V*>::type;
+    using ValueRef = typename std::conditional<IS_CONST, const V&, V&>::type;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<K, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const K&, ValueRef>;
+
+    /// @brief operator->를 위해 참조 쌍을 들고 있는 임시 객체
+    struct pointer
+    {
+        const reference* operator->() const { return &ref; }
+
+        reference ref;
+    };
+
+    FlatMapIterator()
+        : m_key(nullptr)
+        , m_value(nullptr)
+    {
+    }
+
+    FlatMapIterator(const K* key, ValuePtr value)
+        : m_key(key)
+        , m_value(value)
+    {
+    }
+
+    /// @brief 비 const 반복자에서 const 반복자로 변환
+    template<bool8 OTHER_CONST, typename = typename std::enable_if<IS_CONST && !OTHER_CONST>::type>
+    FlatMapIterator(const FlatMapIterator<K, V, OTHER_CONST>& other)
+        : m_key(other.m_key)
+        , m_value(other.m_value)
+    {
+    }
+
+    reference operator*() const { return reference(*m_key, *m_value); }
+    pointer operator->() const { return pointer{reference(*m_key, *m_value)}; }
+    reference operator[](difference_type offset) const { return *(*this + offset); }
+
+    FlatMapIterator& operator++()
+    {
+        ++m_key;
+        ++m_value;
+        return *this;
+    }
+
+    FlatMapIterator operator++(int)
+    {
+        FlatMapIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    FlatMapIterator& operator--()
+    {
+        --m_key;
+        --m_value;
+        return *this;
+    }
+
+    FlatMapIterator operator--(int)
+    {
+        FlatMapIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    FlatMapIterator& operator+=(difference_type offset)
+    {
+        m_key += offset;
+        m_value += offset;
+        return *this;
+    }
+
+    FlatMapIterator& operator-=(difference_type offset)
+    {
+        m_key -= offset;
+        m_value -= offset;
+        return *this;
+    }
+
+    FlatMapIterator operator+(difference_type offset) const
+    {
+        return FlatMapIterator(m_key + offset, m_value + offset);
+    }
+
+    FlatMapIterator operator-(difference_type offset) const
+    {
+        return FlatMapIterator(m_key - offset, m_value - offset);
+    }
+
+    difference_type operator-(const FlatMapIterator& other) const { return m_key - other.m_key; }
+
+    bool8 operator==(const FlatMapIterator& other) const { return m_key == other.m_key; }
+    bool8 operator!=(const FlatMapIterator& other) const { return m_key != other.m_key; }
+    bool8 operator<(const FlatMapIterator& other) const { return m_key < other.m_key; }
+    bool8 operator>(const FlatMapIterator& other) const { return m_key > other.m_key; }
+    bool8 operator<=(const FlatMapIterator& other) const { return m_key <= other.m_key; }
+    bool8 operator>=(const FlatMapIterator& other) const { return m_key >= other.m_key; }
+
+private:
+    const K* m_key;
+    ValuePtr m_value;
+
+    template<typename OK, typename OV, bool8 OTHER_CONST>
+    friend class FlatMapIterator;
+};
+
+/// @brief 정렬된 배열 기반의 Key-Value 맵 컨테이너 (읽기 위주용)
+/// @tparam K Key 타입
+/// @tparam V Value 타입
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note TreeMap과 같은 API를 제공합니다. Key와 Value는 각각 별도의 연속 배열에 정렬 순서로 저장되어
+///       조회는 Key 배열만 분기 없는 이진 탐색으로 읽습니다. 개별 삽입/삭제는 O(n)이므로
+///       로드 시 BuildFrom으로 한 번에 구성하고 이후에는 조회만 하는 용도에 적합합니다.
+///       반복자는 TreeMap과 같이 (const K&, V&) 참조 쌍을 값으로 반환합니다.
+///       Find/Contains/Remove/LowerBound/UpperBound는 TreeMap처럼 K와 < 비교가 되는 다른 타입(StringView8 등)을
+///       그대로 받으므로 조회를 위해 임시 Key를 만들지 않습니다.
+template<typename K, typename V, typename Alloc = DefaultAllocator>
+class FlatMap : private Alloc
+{
+public:
+    using Iterator = FlatMapIterator<K, V, false>;
+    using ConstIterator = FlatMapIterator<K, V, true>;
+    using KeyIterator = const K*;
+    using ValueIterator = V*;
+    using ConstValueIterator = const V*;
+    using Pair = std::pair<K, V>;
+
+    /// @brief 기본 생성자
+    FlatMap()
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit FlatMap(const Alloc& allocator)
+        : Alloc(allocator)
+        , m_keys(allocator)
+        , m_values(allocator)
+    {
+    }
+
+    /// @brief 초기화 리스트로 생성
+    /// @param initList 초기화 리스트 (중복 Key는 처음 것만 유지)
+    FlatMap(std::initializer_list<Pair> initList)
+    {
+        BuildFrom(initList.begin(), static_cast<uint64>(initList.size()));
+    }
+
+    /// @brief 복사 생성자
+    FlatMap(const FlatMap&) = default;
+
+    /// @brief 이동 생성자
+    FlatMap(FlatMap&&) = default;
+
+    /// @brief 복사 대입 연산자 (할당자는 유지)
+    /// @param other 복사할 FlatMap
+    /// @return 자기 자신의 참조
+    FlatMap& operator=(const FlatMap& other)
+    {
+        if (this != &other)
+        {
+            // 둘 중 하나의 복사가 실패해도 Key와 Value 배열의 길이가 어긋나지 않도록 임시 배열에 먼저 복사
+            DynamicArray<K, Alloc> keys(GetAllocator());
+            DynamicArray<V, Alloc> values(GetAllocator());
+            keys = other.m_keys;
+            values = other.m_values;
+            m_keys = std::move(keys);
+            m_values = std::move(values);
+        }
+        return *this;
+    }
+
+    /// @brief 이동 대입 연산자 (할당자도 함께 이동)
+    FlatMap& operator=(FlatMap&&) = default;
+
+    /// @brief 정렬되지 않은 Key-Value 쌍들로 맵을 한 번에 구성 (기존 내용은 제거)
+    /// @param pairs Key-Value 쌍 배열
+    /// @param count 쌍의 개수
+    /// @note 한 번 정렬한 뒤 중복 Key는 처음 나온 것만 유지합니다. O(n log n)
+    ///       임시 배열에 구성한 뒤 교체하므로 예외가 발생하면 기존 내용이 그대로 남습니다.
+    void BuildFrom(const Pair* pairs, uint64 count)
+    {
+        DynamicArray<uint64, Alloc> order(GetAllocator());
+        order.Resize(count);
+        for (uint64 i = 0; i < count; ++i)
+        {
+            order[i] = i;
+        }
+
+        // 같은 Key끼리는 입력 순서를 유지해야 처음 것이 남음
+        std::stable_sort(order.Begin(), order.End(), [pairs](uint64 lhs, uint64 rhs)
+        {
+            return Less(pairs[lhs].first, pairs[rhs].first);
+        });
+
+        DynamicArray<K, Alloc> keys(GetAllocator());
+        DynamicArray<V, Alloc> values(GetAllocator());
+        keys.Reserve(count);
+        values.Reserve(count);
+        for (uint64 i = 0; i < count; ++i)
+        {
+            const Pair& pair = pairs[order[i]];
+            if (!keys.IsEmpty() && !Less(keys.GetBack(), pair.first))
+            {
+                continue;
+            }
+            keys.Add(pair.first);
+            values.Add(pair.second);
+        }
+        m_keys = std::move(keys);
+        m_values = std::move(values);
+    }
+
+    /// @brief 정렬되지 않은 Key-Value 쌍들로 맵을 한 번에 구성 (기존 내용은 제거)
+    /// @param pairs Key-Value 쌍 배열
+    void BuildFrom(const DynamicArray<Pair>& pairs)
+    {
+        BuildFrom(pairs.GetData(), pairs.GetSize());
+    }
+
+    /// @brief Key-Value 쌍 삽입
+    /// @param key 키
+    /// @param value 값
+    /// @return 삽입 성공 시 true, 이미 존재하면 false
+    bool8 Insert(const K& key, const V& value)
+    {
+        uint64 index = LowerIndex(key);
+        if (IsMatch(index, key))
+        {
+            return false;
+        }
+
+        InsertAtIndex(index, key, value);
+        return true;
+    }
+
+    /// @brief Key로 요소 제거
+    /// @param key 제거할 키 (K 또는 K와 비교 가능한 타입)
+    /// @return 제거 성공 시 true, 키가 없으면 false
+    template<typename Q>
+    bool8 Remove(const Q& key)
+    {
+        uint64 index = LowerIndex(key);
+        if (!IsMatch(index, key))
+        {
+            return false;
+        }
+
+        m_keys.RemoveAt(index);
+        m_values.RemoveAt(index);
+        return true;
+    }
+
+    /// @brief Key로 Value 찾기
+    /// @param key 찾을 키 (K 또는 K와 비교 가능한 타입)
+    /// @return Value의 포인터 (없으면 nullptr)
+    template<typename Q>
+    V* Find(const Q& key)
+    {
+        uint64 index = LowerIndex(key);
+        return IsMatch(index, key) ? &m_values[index] : nullptr;
+    }
+
+    /// @brief Key로 Value 찾기 (const 버전)
+    /// @param key 찾을 키 (K 또는 K와 비교 가능한 타입)
+    /// @return Value의 const 포인터 (없으면 nullptr)
+    template<typename Q>
+    const V* Find(const Q& key) const
+    {
+        uint64 index = LowerIndex(key);
+        return IsMatch(index, key) ? &m_values[index] : nullptr;
+    }
+
+    /// @brief Key 존재 여부 확인
+    /// @param key 확인할 키 (K 또는 K와 비교 가능한 타입)
+    /// @return 존재하면 true, 없으면 false
+    template<typename Q>
+    bool8 Contains(const Q& key) const
+    {
+        return IsMatch(LowerIndex(key), key);
+    }
+
+    /// @brief Key로 Value 접근 (없으면 생성)
+    /// @param key 키
+    /// @return Value의 참조
+    V& operator[](const K& key)
+    {
+        uint64 index = LowerIndex(key);
+        if (!IsMatch(index, key))
+        {
+            InsertAtIndex(index, key, V());
+        }
+        return m_values[index];
+    }
+
+    /// @brief Key로 Value 접근 (경계 검사, 없으면 예외)
+    /// @param key 키
+    /// @return Value의 참조
+    V& GetAt(const K& key)
+    {
+        V* value = Find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("FlatMap::GetAt - key not found");
+        }
+        return *value;
+    }
+
+    /// @brief Key로 Value 접근 (경계 검사, 없으면 예외, const 버전)
+    /// @param key 키
+    /// @return Value의 const 참조
+    const V& GetAt(const K& key) const
+    {
+        const V* value = Find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("FlatMap::GetAt - key not found");
+        }
+        return *value;
+    }
+
+    /// @brief 맵의 모든 요소 제거
+    void Clear()
+    {
+        m_keys.Clear();
+        m_values.Clear();
+    }
+
+    /// @brief 맵의 용량 예약
+    /// @param capacity 예약할 요소 개수
+    void Reserve(uint64 capacity)
+    {
+        m_keys.Reserve(capacity);
+        m_values.Reserve(capacity);
+    }
+
+    /// @brief 맵의 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_keys.GetSize();
+    }
+
+    /// @brief 맵이 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_keys.IsEmpty();
+    }
+
+    /// @brief 모든 Key를 복사 없이 순회하는 범위 반환
+    /// @return 정렬된 Key 배열 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<KeyIterator> Keys() const
+    {
+        return IteratorRange<KeyIterator>(m_keys.GetData(), m_keys.GetData() + m_keys.GetSize());
+    }
+
+    /// @brief 모든 Value를 복사 없이 순회하는 범위 반환
+    /// @return Key 순서의 Value 배열 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<ValueIterator> Values()
+    {
+        return IteratorRange<ValueIterator>(m_values.GetData(), m_values.GetData() + m_values.GetSize());
+    }
+
+    /// @brief 모든 Value를 복사 없이 순회하는 범위 반환 (const 버전)
+    /// @return Key 순서의 Value 배열 const 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<ConstValueIterator> Values() const
+    {
+        return IteratorRange<ConstValueIterator>(m_values.GetData(), m_values.GetData() + m_values.GetSize());
+    }
+
+    /// @brief 모든 Key-Value 쌍을 순회하는 범위 반환
+    /// @return 맵 전체 범위 (할당 없음)
+    IteratorRange<Iterator> Items()
+    {
+        return IteratorRange<Iterator>(Begin(), End());
+    }
+
+    /// @brief 모든 Key-Value 쌍을 순회하는 범위 반환 (const 버전)
+    /// @return 맵 전체 const 범위 (할당 없음)
+    IteratorRange<ConstIterator> Items() const
+    {
+        return IteratorRange<ConstIterator>(Begin(), End());
+    }
+
+    /// @brief Key 이상인 첫 번째 요소의 반복자 반환
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    Iterator LowerBound(const Q& key)
+    {
+        return MakeIterator(LowerIndex(key));
+    }
+
+    /// @brief Key 이상인 첫 번째 요소의 반복자 반환 (const 버전)
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return const 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator LowerBound(const Q& key) const
+    {
+        return MakeIterator(LowerIndex(key));
+    }
+
+    /// @brief Key보다 큰 첫 번째 요소의 반복자 반환
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    Iterator UpperBound(const Q& key)
+    {
+        return MakeIterator(UpperIndex(key));
+    }
+
+    /// @brief Key보다 큰 첫 번째 요소의 반복자 반환 (const 버전)
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return const 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator UpperBound(const Q& key) const
+    {
+        return MakeIterator(UpperIndex(key));
+    }
+
+    /// @brief [first, last) 구간의 Key를 가진 요소들의 범위 반환
+    /// @param first 범위 시작 키 (포함)
+    /// @param last 범위 끝 키 (제외)
+    /// @return 정렬 순서로 순회하는 범위
+    IteratorRange<Iterator> Range(const K& first, const K& last)
+    {
+        return IteratorRange<Iterator>(LowerBound(first), LowerBound(last));
+    }
+
+    /// @brief [first, last) 구간의 Key를 가진 요소들의 범위 반환 (const 버전)
+    /// @param first 범위 시작 키 (포함)
+    /// @param last 범위 끝 키 (제외)
+    /// @return 정렬 순서로 순회하는 const 범위
+    IteratorRange<ConstIterator> Range(const K& first, const K& last) const
+    {
+        return IteratorRange<ConstIterator>(LowerBound(first), LowerBound(last));
+    }
+
+    /// @brief 맵의 시작 반복자 반환
+    /// @return 시작 반복자
+    Iterator Begin()
+    {
+        return MakeIterator(0);
+    }
+
+    /// @brief 맵의 시작 반복자 반환 (const 버전)
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return MakeIterator(0);
+    }
+
+    /// @brief 맵의 끝 반복자 반환
+    /// @return 끝 반복자
+    Iterator End()
+    {
+        return MakeIterator(GetSize());
+    }
+
+    /// @brief 맵의 끝 반복자 반환 (const 버전)
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return MakeIterator(GetSize());
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return *this;
+    }
+
+    // Range-based for loop 지원
+    Iterator begin() { return Begin(); }
+    ConstIterator begin() const { return Begin(); }
+    Iterator end() { return End(); }
+    ConstIterator end() const { return End(); }
+
+private:
+    // std::less<>는 is_transparent이므로 K가 아닌 타입으로도 비교 가능
+    template<typename L, typename R>
+    static bool8 Less(const L& lhs, const R& rhs)
+    {
+        return std::less<>()(lhs, rhs);
+    }
+
+    template<typename Q>
+    uint64 LowerIndex(const Q& key) const
+    {
+        return BranchlessLowerBound(m_keys.GetData(), m_keys.GetSize(), key, std::less<>());
+    }
+
+    template<typename Q>
+    uint64 UpperIndex(const Q& key) const
+    {
+        return BranchlessUpperBound(m_keys.GetData(), m_keys.GetSize(), key, std::less<>());
+    }
+
+    template<typename Q>
+    bool8 IsMatch(uint64 index, const Q& key) const
+    {
+        return index < m_keys.GetSize() && !Less(key, m_keys[index]);
+    }
+
+    // Value 삽입이 실패하면 Key 삽입을 되돌려 두 배열의 길이를 맞춤
+    void InsertAtIndex(uint64 index, const K& key, const V& value)
+    {
+        m_keys.InsertAt(index, key);
+        try
+        {
+            m_values.InsertAt(index, value);
+        }
+        catch (...)
+        {
+            m_keys.RemoveAt(index);
+            throw;
+        }
+    }
+
+    Iterator MakeIterator(uint64 index)
+    {
+        return Iterator(m_keys.GetData() + index, m_values.GetData() + index);
+    }
+
+    ConstIterator MakeIterator(uint64 index) const
+    {
+        return ConstIterator(m_keys.GetData() + index, m_values.GetData() + index);
+    }
+
+    DynamicArray<K, Alloc> m_keys;
+    DynamicArray<V, Alloc> m_values;
+};
+
+} // namespace Excep
@@ -0,0 +1,267 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/BinarySearch.h"
+#include "Container/DynamicArray.h"
+#include "Container/IteratorRange.h"
+#include "Memory/Allocator.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 정렬된 배열 기반의 unique 요소 집합 컨테이너 (읽기 위주용)
+/// @tparam T 저장할 요소의 타입
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note TreeSet과 같은 API를 제공합니다. 요소는 하나의 연속 배열에 정렬 순서로 저장되어
+///       조회는 분기 없는 이진 탐색을 사용합니다. 개별 삽입/삭제는 O(n)이므로
+///       로드 시 BuildFrom으로 한 번에 구성하고 이후에는 조회만 하는 용도에 적합합니다.
+///       Contains/Remove/LowerBound/UpperBound는 TreeSet처럼 T와 < 비교가 되는 다른 타입(StringView8 등)을
+///       그대로 받으므로 조회를 위해 임시 요소를 만들지 않습니다.
+template<typename T, typename Alloc = DefaultAllocator>
+class FlatSet : private Alloc
+{
+private:
+    using StorageType = DynamicArray<T, Alloc>;
+
+public:
+    using Iterator = typename StorageType::ConstIterator;
+    using ConstIterator = typename StorageType::ConstIterator;
+
+    /// @brief 기본 생성자
+    FlatSet()
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit FlatSet(const Alloc& allocator)
+        : Alloc(allocator)
+        , m_data(allocator)
+    {
+    }
+
+    /// @brief 초기화 리스트로 생성
+    /// @param initList 초기화 리스트 (중복 요소는 하나만 유지)
+    FlatSet(std::initializer_list<T> initList)
+    {
+        BuildFrom(initList.begin(), static_cast<uint64>(initList.size()));
+    }
+
+    /// @brief 복사 생성자
+    FlatSet(const FlatSet&) = default;
+
+    /// @brief 이동 생성자
+    FlatSet(FlatSet&&) = default;
+
+    /// @brief 복사 대입 연산자 (할당자는 유지)
+    /// @param other 복사할 FlatSet
+    /// @return 자기 자신의 참조
+    FlatSet& operator=(const FlatSet& other)
+    {
+        if (this != &other)
+        {
+            m_data = other.m_data;
+        }
+        return *this;
+    }
+
+    /// @brief 이동 대입 연산자 (할당자도 함께 이동)
+    FlatSet& operator=(FlatSet&&) = default;
+
+    /// @brief 정렬되지 않은 요소들로 집합을 한 번에 구성 (기존 내용은 제거)
+    /// @param values 요소 배열
+    /// @param count 요소 개수
+    /// @note 한 번 정렬한 뒤 중복을 제거합니다. O(n log n)
+    ///       임시 배열에 구성한 뒤 교체하므로 values가 이 집합의 GetData()여도 안전하고,
+    ///       예외가 발생하면 기존 내용이 그대로 남습니다.
+    void BuildFrom(const T* values, uint64 count)
+    {
+        StorageType sorted(GetAllocator());
+        sorted.Reserve(count);
+        for (uint64 i = 0; i < count; ++i)
+        {
+            sorted.Add(values[i]);
+        }
+
+        // 조회와 같은 비교자를 써야 정렬 순서와 탐색 결과가 어긋나지 않음
+        std::sort(sorted.Begin(), sorted.End(), std::less<>());
+        auto last = std::unique(sorted.Begin(), sorted.End(), [](const T& lhs, const T& rhs)
+        {
+            return !std::less<>()(lhs, rhs);
+        });
+        const uint64 uniqueCount = static_cast<uint64>(last - sorted.Begin());
+        while (sorted.GetSize() > uniqueCount)
+        {
+            sorted.Pop();
+        }
+        m_data = std::move(sorted);
+    }
+
+    /// @brief 정렬되지 않은 요소들로 집합을 한 번에 구성 (기존 내용은 제거)
+    /// @param values 요소 배열
+    void BuildFrom(const DynamicArray<T>& values)
+    {
+        BuildFrom(values.GetData(), values.GetSize());
+    }
+
+    /// @brief 요소 삽입
+    /// @param value 삽입할 요소
+    /// @return 삽입 성공 시 true, 이미 존재하면 false
+    bool8 Insert(const T& value)
+    {
+        uint64 index = LowerIndex(value);
+        if (IsMatch(index, value))
+        {
+            return false;
+        }
+
+        m_data.InsertAt(index, value);
+        return true;
+    }
+
+    /// @brief 요소 제거
+    /// @param value 제거할 요소 (T 또는 T와 비교 가능한 타입)
+    /// @return 제거 성공 시 true, 요소가 없으면 false
+    template<typename Q>
+    bool8 Remove(const Q& value)
+    {
+        uint64 index = LowerIndex(value);
+        if (!IsMatch(index, value))
+        {
+            return false;
+        }
+
+        m_data.RemoveAt(index);
+        return true;
+    }
+
+    /// @brief 요소 존재 여부 확인
+    /// @param value 확인할 요소 (T 또는 T와 비교 가능한 타입)
+    /// @return 존재하면 true, 없으면 false
+    template<typename Q>
+    bool8 Contains(const Q& value) const
+    {
+        return IsMatch(LowerIndex(value), value);
+    }
+
+    /// @brief 집합의 모든 요소 제거
+    void Clear()
+    {
+        m_data.Clear();
+    }
+
+    /// @brief 집합의 용량 예약
+    /// @param capacity 예약할 요소 개수
+    void Reserve(uint64 capacity)
+    {
+        m_data.Reserve(capacity);
+    }
+
+    /// @brief 집합의 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_data.GetSize();
+    }
+
+    /// @brief 집합이 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_data.IsEmpty();
+    }
+
+    /// @brief 모든 요소를 복사 없이 순회하는 범위 반환
+    /// @return 집합 전체 범위 (정렬된 순서, 할당 없음, 집합을 수정하면 무효화됨)
+    IteratorRange<ConstIterator> Items() const
+    {
+        return IteratorRange<ConstIterator>(Begin(), End());
+    }
+
+    /// @brief 정렬된 요소 배열의 원시 데이터 포인터 반환
+    /// @return 첫 번째 요소를 가리키는 const 포인터
+    const T* GetData() const
+    {
+        return m_data.GetData();
+    }
+
+    /// @brief value 이상인 첫 번째 요소의 반복자 반환
+    /// @param value 기준 값 (T 또는 T와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator LowerBound(const Q& value) const
+    {
+        return m_data.Begin() + static_cast<std::ptrdiff_t>(LowerIndex(value));
+    }
+
+    /// @brief value보다 큰 첫 번째 요소의 반복자 반환
+    /// @param value 기준 값 (T 또는 T와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator UpperBound(const Q& value) const
+    {
+        return m_data.Begin() + static_cast<std::ptrdiff_t>(UpperIndex(value));
+    }
+
+    /// @brief [first, last) 구간의 요소들의 범위 반환
+    /// @param first 범위 시작 값 (포함)
+    /// @param last 범위 끝 값 (제외)
+    /// @return 정렬 순서로 순회하는 범위
+    IteratorRange<ConstIterator> Range(const T& first, const T& last) const
+    {
+        return IteratorRange<ConstIterator>(LowerBound(first), LowerBound(last));
+    }
+
+    /// @brief 집합의 시작 반복자 반환
+    /// @return 시작 반복자
+    ConstIterator Begin() const
+    {
+        return m_data.Begin();
+    }
+
+    /// @brief 집합의 끝 반복자 반환
+    /// @return 끝 반복자
+    ConstIterator End() const
+    {
+        return m_data.End();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return *this;
+    }
+
+    // Range-based for loop 지원
+    ConstIterator begin() const { return m_data.Begin(); }
+    ConstIterator end() const { return m_data.End(); }
+
+private:
+    // std::less<>는 is_transparent이므로 T가 아닌 타입으로도 비교 가능
+    template<typename Q>
+    uint64 LowerIndex(const Q& value) const
+    {
+        return BranchlessLowerBound(m_data.GetData(), m_data.GetSize(), value, std::less<>());
+    }
+
+    template<typename Q>
+    uint64 UpperIndex(const Q& value) const
+    {
+        return BranchlessUpperBound(m_data.GetData(), m_data.GetSize(), value, std::less<>());
+    }
+
+    template<typename Q>
+    bool8 IsMatch(uint64 index, const Q& value) const
+    {
+        return index < m_data.GetSize() && !std::less<>()(value, m_data[index]);
+    }
+
+    StorageType m_data;
+};
+
+} // namespace Excep
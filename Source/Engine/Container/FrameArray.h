@@ -0,0 +1,17 @@
+﻿#pragma once
+#include "Container/DynamicArray.h"
+#include "Memory/FrameArena.h"
+
+namespace Excep
+{
+
+/// @brief FrameArena에서 할당하는 프레임 임시 동적 배열
+/// @tparam T 저장할 요소의 타입
+/// @note 생성 시 FrameArena를 지정해야 합니다 (예: FrameArray<CRenderer*> visible(frameArena)).
+///       해제는 아무 일도 하지 않으므로 커지면서 버린 이전 버퍼는 프레임 끝까지 남습니다.
+///       크기를 알면 Reserve로 한 번에 할당하는 것이 좋습니다.
+///       할당한 프레임의 다음 프레임이 끝나기 전에 소멸되어야 하므로 멤버 변수로 두지 않습니다.
+template<typename T>
+using FrameArray = DynamicArray<T, FrameAllocator>;
+
+} // namespace Excep
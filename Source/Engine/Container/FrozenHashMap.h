@@ -0,0 +1,420 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/BitVector.h"
+#include "Container/DynamicArray.h"
+#include "Container/Hash.h"
+#include "Container/HashMap.h"
+#include "Container/IteratorRange.h"
+#include "Container/Sort.h"
+#include "Container/TreeMap.h"
+#include "Memory/Allocator.h"
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 로드 후 바뀌지 않는 Key 집합을 위한 완전 해시(minimal perfect hash) 기반 읽기 전용 맵
+/// @tparam K Key 타입
+/// @tparam V Value 타입
+/// @tparam Hasher 해시 함수 객체 (기본값: Hash<K>)
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 생성 시 CHD(hash, displace) 방식으로 Key마다 겹치지 않는 슬롯을 정하고,
+///       버킷별 변위 값 배열과 슬롯 순서의 Key-Value 배열, 두 개의 연속 배열에만 저장합니다.
+///       Find는 해시 한 번, 변위 값 읽기 한 번, Key 비교 한 번으로 끝나며 탐사(probing)가 없습니다.
+///       Key를 추가/제거할 수 없으므로 메시 타입 이름, 셰이더 진입점, 설정 Key처럼 로드 후 고정되는 테이블에 사용합니다.
+template<typename K, typename V, typename Hasher = Hash<K>, typename Alloc = DefaultAllocator>
+class FrozenHashMap
+{
+public:
+    using Pair = std::pair<K, V>;
+    using Iterator = const Pair*;
+    using ConstIterator = const Pair*;
+    using KeyIterator = ProjectionIterator<ConstIterator, PairFirst>;
+    using ConstValueIterator = ProjectionIterator<ConstIterator, PairSecond>;
+
+    /// @brief 버킷 하나에 들어가는 평균 Key 개수 (클수록 변위 배열이 작아지고 생성이 느려짐)
+    static constexpr uint64 KEYS_PER_BUCKET = 4;
+
+    /// @brief 기본 생성자 (빈 맵)
+    FrozenHashMap()
+        : m_seeds()
+        , m_entries()
+        , m_salt(0)
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성 (빈 맵)
+    /// @param allocator 사용할 할당자
+    explicit FrozenHashMap(const Alloc& allocator)
+        : m_seeds(allocator)
+        , m_entries(allocator)
+        , m_salt(0)
+    {
+    }
+
+    /// @brief 초기화 리스트로 생성 (같은 Key가 여러 번 나오면 처음 것을 사용)
+    /// @param initList 초기화 리스트
+    FrozenHashMap(std::initializer_list<Pair> initList)
+        : FrozenHashMap()
+    {
+        BuildFrom(initList);
+    }
+
+    /// @brief HashMap의 모든 요소로 생성
+    /// @param map 원본 맵
+    /// @param allocator 사용할 할당자
+    template<typename SourceHasher, typename SourceAlloc>
+    explicit FrozenHashMap(const HashMap<K, V, SourceHasher, SourceAlloc>& map, const Alloc& allocator = Alloc())
+        : FrozenHashMap(allocator)
+    {
+        BuildFrom(map.Items());
+    }
+
+    /// @brief TreeMap의 모든 요소로 생성
+    /// @param map 원본 맵
+    /// @param allocator 사용할 할당자
+    template<typename SourceAlloc>
+    explicit FrozenHashMap(const TreeMap<K, V, SourceAlloc>& map, const Alloc& allocator = Alloc())
+        : FrozenHashMap(allocator)
+    {
+        BuildFrom(map.Items());
+    }
+
+    /// @brief Key-Value 쌍 범위로 맵을 다시 구성 (기존 요소는 모두 제거)
+    /// @param pairs first/second를 가진 요소의 범위 (같은 Key가 여러 번 나오면 처음 것을 사용)
+    /// @note 서로 다른 Key의 해시 값(64비트)이 완전히 같으면 완전 해시를 만들 수 없으므로 예외를 던집니다
+    template<typename Range>
+    void BuildFrom(const Range& pairs)
+    {
+        DynamicArray<Pair, Alloc> source(m_entries.GetAllocator());
+        for (const auto& pair : pairs)
+        {
+            source.Emplace(pair.first, pair.second);
+        }
+        Build(source);
+    }
+
+    /// @brief Key로 Value 찾기
+    /// @param key 찾을 키
+    /// @return Value의 const 포인터 (없으면 nullptr)
+    const V* Find(const K& key) const
+    {
+        return FindImpl(key);
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 Value 찾기 (Hasher가 is_transparent인 경우)
+    /// @param key 찾을 키 (StringView8, 문자열 리터럴 등)
+    /// @return Value의 const 포인터 (없으면 nullptr)
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    const V* Find(const Q& key) const
+    {
+        return FindImpl(key);
+    }
+
+    /// @brief Key 존재 여부 확인
+    /// @param key 확인할 키
+    /// @return 존재하면 true, 없으면 false
+    bool8 Contains(const K& key) const
+    {
+        return FindImpl(key) != nullptr;
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 존재 여부 확인 (Hasher가 is_transparent인 경우)
+    /// @param key 확인할 키 (StringView8, 문자열 리터럴 등)
+    /// @return 존재하면 true, 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 Contains(const Q& key) const
+    {
+        return FindImpl(key) != nullptr;
+    }
+
+    /// @brief Key로 Value 접근 (경계 검사 수행)
+    /// @param key 찾을 키
+    /// @return Value의 const 참조
+    const V& GetAt(const K& key) const
+    {
+        const V* value = FindImpl(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("FrozenHashMap::GetAt - key not found");
+        }
+        return *value;
+    }
+
+    /// @brief 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_entries.GetSize();
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_entries.IsEmpty();
+    }
+
+    /// @brief 모든 Key를 복사 없이 순회하는 범위 반환
+    /// @return const K&를 돌려주는 범위 (순서는 슬롯 순서)
+    IteratorRange<KeyIterator> Keys() const
+    {
+        return MakeProjectionRange<PairFirst>(Begin(), End());
+    }
+
+    /// @brief 모든 Value를 복사 없이 순회하는 범위 반환
+    /// @return const V&를 돌려주는 범위 (순서는 슬롯 순서)
+    IteratorRange<ConstValueIterator> Values() const
+    {
+        return MakeProjectionRange<PairSecond>(Begin(), End());
+    }
+
+    /// @brief 모든 Key-Value 쌍을 순회하는 범위 반환
+    /// @return 맵 전체 범위
+    IteratorRange<ConstIterator> Items() const
+    {
+        return IteratorRange<ConstIterator>(Begin(), End());
+    }
+
+    /// @brief 시작 반복자 반환
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return m_entries.GetData();
+    }
+
+    /// @brief 끝 반복자 반환
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return m_entries.GetData() + m_entries.GetSize();
+    }
+
+    // Range-based for loop 지원
+    ConstIterator begin() const { return Begin(); }
+    ConstIterator end() const { return End(); }
+
+private:
+    /// @brief 변위 값의 이 비트가 켜져 있으면 나머지 비트가 슬롯 인덱스 (Key가 하나뿐인 버킷)
+    static constexpr uint32 DIRECT_SLOT_BIT = 0x80000000u;
+
+    /// @brief 버킷 하나의 변위 값을 찾는 최대 시도 횟수 (넘으면 salt를 바꿔 처음부터 다시 구성)
+    static constexpr uint32 MAX_SEED_ATTEMPTS = 1u << 20;
+
+    /// @brief 해시를 섞은 값 (상위 비트로 버킷 선택, 전체로 슬롯 계산)
+    uint64 MixKeyHash(uint64 hash) const
+    {
+        return MixHash(hash ^ m_salt);
+    }
+
+    uint64 GetBucket(uint64 mixed) const
+    {
+        return (mixed >> 32) % m_seeds.GetSize();
+    }
+
+    static uint64 GetSlot(uint64 mixed, uint32 seed, uint64 slotCount)
+    {
+        return MixHash(mixed + seed * 0x9E3779B97F4A7C15ull) % slotCount;
+    }
+
+    template<typename Q>
+    const V* FindImpl(const Q& key) const
+    {
+        if (m_entries.IsEmpty())
+        {
+            return nullptr;
+        }
+
+        const uint64 mixed = MixKeyHash(m_hasher(key));
+        const uint32 seed = m_seeds[GetBucket(mixed)];
+        const uint64 slot = (seed & DIRECT_SLOT_BIT) ? (seed & ~DIRECT_SLOT_BIT) : GetSlot(mixed, seed, GetSize());
+        const Pair& entry = m_entries[slot];
+        return (entry.first == key) ? &entry.second : nullptr;
+    }
+
+    /// @brief 중복 Key를 제거하고 완전 해시를 구성하여 source를 슬롯 순서로 옮김
+    void Build(DynamicArray<Pair, Alloc>& source)
+    {
+        const Alloc allocator = m_entries.GetAllocator();
+        m_entries.Clear();
+        m_seeds.Clear();
+
+        // 해시 순으로 정렬하여 같은 Key(처음 것만 사용)와 해시가 같은 서로 다른 Key를 찾음
+        DynamicArray<uint64, Alloc> hashes(allocator);
+        DynamicArray<uint64, Alloc> order(allocator);
+        hashes.Reserve(source.GetSize());
+        order.Reserve(source.GetSize());
+        for (uint64 i = 0; i < source.GetSize(); ++i)
+        {
+            hashes.Add(m_hasher(source[i].first));
+            order.Add(i);
+        }
+        StableSort(order, [&hashes](uint64 lhs, uint64 rhs) { return hashes[lhs] < hashes[rhs]; });
+
+        DynamicArray<uint64, Alloc> unique(allocator);
+        unique.Reserve(order.GetSize());
+        for (uint64 i = 0; i < order.GetSize(); ++i)
+        {
+            const uint64 index = order[i];
+            if (!unique.IsEmpty() && hashes[unique.GetBack()] == hashes[index])
+            {
+                if (source[unique.GetBack()].first == source[index].first)
+                {
+                    continue;
+                }
+                throw std::invalid_argument("FrozenHashMap::BuildFrom - distinct keys share a hash");
+            }
+            unique.Add(index);
+        }
+
+        const uint64 count = unique.GetSize();
+        if (count == 0)
+        {
+            return;
+        }
+
+        DynamicArray<uint64, Alloc> slots(allocator);
+        for (m_salt = 0; !TryAssignSlots(hashes, unique, slots); m_salt += 0x9E3779B97F4A7C15ull)
+        {
+        }
+
+        // 슬롯 순서로 배치
+        DynamicArray<uint64, Alloc> sourceOfSlot(allocator);
+        sourceOfSlot.Resize(count, 0);
+        for (uint64 i = 0; i < count; ++i)
+        {
+            sourceOfSlot[slots[i]] = unique[i];
+        }
+        m_entries.Reserve(count);
+        for (uint64 slot = 0; slot < count; ++slot)
+        {
+            m_entries.Add(std::move(source[sourceOfSlot[slot]]));
+        }
+    }
+
+    /// @brief 현재 salt로 변위 값을 구함
+    /// @param hashes source 순서의 해시 값
+    /// @param keys 사용할 source 인덱스 (해시가 모두 다름)
+    /// @param outSlots keys[i]가 놓일 슬롯
+    /// @return 모든 버킷의 변위 값을 찾았으면 true
+    bool8 TryAssignSlots(const DynamicArray<uint64, Alloc>& hashes, const DynamicArray<uint64, Alloc>& keys,
+                         DynamicArray<uint64, Alloc>& outSlots)
+    {
+        const Alloc allocator = m_entries.GetAllocator();
+        const uint64 count = keys.GetSize();
+        const uint64 bucketCount = (count + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET;
+        m_seeds.Clear();
+        m_seeds.Resize(bucketCount, 0);
+
+        // 버킷별로 Key를 모음 (계수 정렬)
+        DynamicArray<uint64, Alloc> mixed(allocator);
+        DynamicArray<uint64, Alloc> bucketStart(allocator);
+        DynamicArray<uint64, Alloc> bucketKeys(allocator);
+        mixed.Reserve(count);
+        bucketStart.Resize(bucketCount + 1, 0);
+        bucketKeys.Resize(count, 0);
+        for (uint64 i = 0; i < count; ++i)
+        {
+            mixed.Add(MixKeyHash(hashes[keys[i]]));
+            ++bucketStart[GetBucket(mixed[i]) + 1];
+        }
+        for (uint64 bucket = 0; bucket < bucketCount; ++bucket)
+        {
+            bucketStart[bucket + 1] += bucketStart[bucket];
+        }
+        {
+            DynamicArray<uint64, Alloc> fill(allocator);
+            fill.AddRange(bucketStart);
+            for (uint64 i = 0; i < count; ++i)
+            {
+                bucketKeys[fill[GetBucket(mixed[i])]++] = i;
+            }
+        }
+
+        // Key가 많은 버킷부터 배치 (비어 있는 슬롯이 많을 때 어려운 버킷을 먼저 처리)
+        DynamicArray<uint64, Alloc> buckets(allocator);
+        buckets.Reserve(bucketCount);
+        for (uint64 bucket = 0; bucket < bucketCount; ++bucket)
+        {
+            buckets.Add(bucket);
+        }
+        StableSort(buckets, [&bucketStart](uint64 lhs, uint64 rhs)
+        {
+            return bucketStart[lhs + 1] - bucketStart[lhs] > bucketStart[rhs + 1] - bucketStart[rhs];
+        });
+
+        BitVector<Alloc> occupied(allocator);
+        occupied.Resize(count);
+        outSlots.Clear();
+        outSlots.Resize(count, 0);
+        uint64 nextFreeSlot = 0;
+
+        for (uint64 i = 0; i < bucketCount; ++i)
+        {
+            const uint64 bucket = buckets[i];
+            const uint64 first = bucketStart[bucket];
+            const uint64 last = bucketStart[bucket + 1];
+            if (last - first == 0)
+            {
+                break;
+            }
+
+            if (last - first == 1)
+            {
+                // Key가 하나뿐이면 남은 슬롯에 바로 배치하고 슬롯 인덱스를 변위 값에 기록
+                while (occupied.Test(nextFreeSlot))
+                {
+                    ++nextFreeSlot;
+                }
+                occupied.Set(nextFreeSlot);
+                outSlots[bucketKeys[first]] = nextFreeSlot;
+                m_seeds[bucket] = DIRECT_SLOT_BIT | static_cast<uint32>(nextFreeSlot);
+                continue;
+            }
+
+            uint32 seed = 0;
+            for (; seed < MAX_SEED_ATTEMPTS; ++seed)
+            {
+                uint64 placed = first;
+                for (; placed < last; ++placed)
+                {
+                    const uint64 key = bucketKeys[placed];
+                    const uint64 slot = GetSlot(mixed[key], seed, count);
+                    if (occupied.Test(slot))
+                    {
+                        break;
+                    }
+                    occupied.Set(slot);
+                    outSlots[key] = slot;
+                }
+
+                if (placed == last)
+                {
+                    break;
+                }
+
+                // 같은 버킷에서 이미 차지한 슬롯을 되돌리고 다음 변위 값 시도
+                for (uint64 j = first; j < placed; ++j)
+                {
+                    occupied.Reset(outSlots[bucketKeys[j]]);
+                }
+            }
+
+            if (seed == MAX_SEED_ATTEMPTS)
+            {
+                return false;
+            }
+            m_seeds[bucket] = seed;
+        }
+        return true;
+    }
+
+    DynamicArray<uint32, Alloc> m_seeds;
+    DynamicArray<Pair, Alloc> m_entries;
+    uint64 m_salt;
+    Hasher m_hasher;
+};
+
+} // namespace Excep
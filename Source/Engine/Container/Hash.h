@@ -0,0 +1,87 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <functional>
+#include <type_traits>
+
+namespace Excep
+{
+
+/// @brief 엔진 해시 컨테이너의 기본 해시 함수 객체
+/// @tparam T 해시할 타입
+/// @note 기본 구현은 std::hash를 사용하며, 엔진 타입은 이 템플릿을 특수화합니다
+template<typename T>
+struct Hash
+{
+    uint64 operator()(const T& value) const
+    {
+        return static_cast<uint64>(std::hash<T>()(value));
+    }
+};
+
+/// @brief 해시/비교 함수 객체가 Key가 아닌 타입으로도 조회할 수 있는지 확인 (is_transparent 정의 여부)
+/// @tparam T 해시 또는 비교 함수 객체 타입
+template<typename T, typename = void>
+struct IsTransparent : std::false_type
+{
+};
+
+template<typename T>
+struct IsTransparent<T, typename std::conditional<true, void, typename T::is_transparent>::type> : std::true_type
+{
+};
+
+/// @brief Fn이 is_transparent일 때만 Q를 조회 Key 타입으로 허용하는 SFINAE 헬퍼
+template<typename Fn, typename Q>
+using EnableIfTransparent = typename std::enable_if<IsTransparent<Fn>::value, Q>::type;
+
+/// @brief 해시 값을 미리 계산해 둔 조회 Key
+/// @tparam Q 조회 Key 타입
+/// @note 같은 Key로 여러 번 조회하거나 해시를 다른 곳에 저장해 둔 경우 해시 계산을 건너뜁니다.
+///       hash는 반드시 컨테이너의 Hasher로 계산한 값(MixHash 이전)이어야 합니다.
+///       Key는 참조로 보관하므로 Find/Contains/Remove 호출 식 안에서 만들어 바로 넘깁니다.
+template<typename Q>
+struct PrehashedKey
+{
+    const Q& key;
+    uint64 hash;
+};
+
+/// @brief PrehashedKey 생성
+/// @param key 조회 Key
+/// @param hash Hasher로 미리 계산한 해시 값
+/// @return PrehashedKey
+template<typename Q>
+PrehashedKey<Q> MakePrehashedKey(const Q& key, uint64 hash)
+{
+    return PrehashedKey<Q>{ key, hash };
+}
+
+/// @brief 해시 값의 비트를 고르게 섞습니다
+/// @param hash 원본 해시 값
+/// @return 상위/하위 비트가 모두 섞인 해시 값
+/// @note std::hash는 정수에 대해 항등 함수인 구현이 있으므로 Open Addressing 테이블은 반드시 섞어서 사용합니다
+inline uint64 MixHash(uint64 hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/// @brief 바이트 배열의 해시 값을 계산합니다 (FNV-1a 64비트)
+/// @param data 바이트 배열
+/// @param size 바이트 수
+/// @return 해시 값
+inline uint64 HashBytes(const void* data, uint64 size)
+{
+    const uint8* bytes = static_cast<const uint8*>(data);
+    uint64 hash = 0xCBF29CE484222325ull;
+    for (uint64 i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+} // namespace Excep
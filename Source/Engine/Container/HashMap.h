@@ -1,34 +1,137 @@
 ﻿#pragma once
 #include "Core/Types.h"
-#include "Container/DynamicArray.h"
-#include <unordered_map>
+#include "Container/FlatHashTable.h"
+#include "Container/Hash.h"
+#include "Container/IteratorRange.h"
 #include <initializer_list>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace Excep
 {
 
-/// @brief std::unordered_map을 래핑한 해시 기반 Key-Value 맵 컨테이너
+/// @brief HashMap의 순방향 반복자 (Key를 고칠 수 없도록 (const K&, V&) 참조 쌍을 값으로 반환)
 /// @tparam K Key 타입
 /// @tparam V Value 타입
-template<typename K, typename V>
+/// @tparam IS_CONST const 반복자 여부
+/// @note 슬롯은 재해시 때 Key를 이동할 수 있도록 std::pair<K, V>로 저장하고, 반복자에서만 Key를 const로 노출합니다
+template<typename K, typename V, bool8 IS_CONST>
+class HashMapIterator
+{
+private:
+    using Slot = typename std::conditional<IS_CONST, const std::pair<K, V>, std::pair<K, V>>::type;
+    using SlotIterator = FlatHashIterator<Slot>;
+    using ValueRef = typename std::conditional<IS_CONST, const V&, V&>::type;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<K, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const K&, ValueRef>;
+
+    /// @brief operator->를 위해 참조 쌍을 들고 있는 임시 객체
+    struct pointer
+    {
+        const reference* operator->() const { return &ref; }
+
+        reference ref;
+    };
+
+    HashMapIterator()
+        : m_it()
+    {
+    }
+
+    explicit HashMapIterator(SlotIterator it)
+        : m_it(it)
+    {
+    }
+
+    /// @brief 비 const 반복자에서 const 반복자로 변환
+    template<bool8 OTHER_CONST, typename = typename std::enable_if<IS_CONST && !OTHER_CONST>::type>
+    HashMapIterator(const HashMapIterator<K, V, OTHER_CONST>& other)
+        : m_it(other.m_it)
+    {
+    }
+
+    reference operator*() const { return reference(m_it->first, m_it->second); }
+    pointer operator->() const { return pointer{reference(m_it->first, m_it->second)}; }
+
+    HashMapIterator& operator++()
+    {
+        ++m_it;
+        return *this;
+    }
+
+    HashMapIterator operator++(int)
+    {
+        HashMapIterator temp = *this;
+        ++m_it;
+        return temp;
+    }
+
+    bool8 operator==(const HashMapIterator& other) const { return m_it == other.m_it; }
+    bool8 operator!=(const HashMapIterator& other) const { return m_it != other.m_it; }
+
+private:
+    SlotIterator m_it;
+
+    template<typename OK, typename OV, bool8 OTHER_CONST>
+    friend class HashMapIterator;
+};
+
+/// @brief Open Addressing 해시 테이블 기반 Key-Value 맵 컨테이너
+/// @tparam K Key 타입
+/// @tparam V Value 타입
+/// @tparam Hasher 해시 함수 객체 (기본값: Hash<K>)
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 노드 할당 없이 연속된 슬롯 배열에 저장합니다.
+///       반복자는 TreeMap처럼 (const K&, V&) 참조 쌍을 값으로 반환하므로 순회 중 Key를 바꿀 수 없으며,
+///       range-based for에서는 `for (const auto& pair : map)` 또는 `for (auto pair : map)` 형태로 사용합니다.
+///       삽입으로 재해시가 일어나면 Find가 반환한 포인터와 반복자는 무효화됩니다.
+///       Hasher가 is_transparent를 정의하면 (String8/StringView8의 Hash 등) Find/Contains/Remove에
+///       K를 만들지 않고 StringView8, 문자열 리터럴, PrehashedKey를 그대로 넘길 수 있습니다.
+template<typename K, typename V, typename Hasher = Hash<K>, typename Alloc = DefaultAllocator>
 class HashMap
 {
 public:
-    using Iterator = typename std::unordered_map<K, V>::iterator;
-    using ConstIterator = typename std::unordered_map<K, V>::const_iterator;
     using Pair = std::pair<K, V>;
 
+private:
+    using Table = FlatHashTable<K, Pair, PairKeyOf<K, Pair>, Hasher, Alloc>;
+
+public:
+    using Iterator = HashMapIterator<K, V, false>;
+    using ConstIterator = HashMapIterator<K, V, true>;
+    using KeyIterator = ProjectionIterator<ConstIterator, PairFirst>;
+    using ValueIterator = ProjectionIterator<Iterator, PairSecond>;
+    using ConstValueIterator = ProjectionIterator<ConstIterator, PairSecond>;
+
     /// @brief 기본 생성자
     HashMap()
     {
     }
 
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit HashMap(const Alloc& allocator)
+        : m_data(allocator)
+    {
+    }
+
     /// @brief 초기화 리스트로 생성
     /// @param initList 초기화 리스트
     HashMap(std::initializer_list<Pair> initList)
-        : m_data(initList)
     {
+        m_data.Reserve(static_cast<uint64>(initList.size()));
+        for (const auto& pair : initList)
+        {
+            Insert(pair.first, pair.second);
+        }
     }
 
     /// @brief Key-Value 쌍 삽입
@@ -37,8 +140,7 @@ public:
     /// @return 삽입 성공 시 true, 이미 존재하면 false
     bool8 Insert(const K& key, const V& value)
     {
-        auto result = m_data.insert({key, value});
-        return result.second;
+        return m_data.TryEmplace(key, key, value).second;
     }
 
     /// @brief Key로 요소 제거
@@ -46,7 +148,16 @@ public:
     /// @return 제거 성공 시 true, 키가 없으면 false
     bool8 Remove(const K& key)
     {
-        return m_data.erase(key) > 0;
+        return m_data.Remove(key);
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 요소 제거 (Hasher가 is_transparent인 경우)
+    /// @param key 제거할 키 (StringView8, 문자열 리터럴, PrehashedKey 등)
+    /// @return 제거 성공 시 true, 키가 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 Remove(const Q& key)
+    {
+        return m_data.Remove(key);
     }
 
     /// @brief Key로 Value 찾기
@@ -54,10 +165,10 @@ public:
     /// @return Value의 포인터 (없으면 nullptr)
     V* Find(const K& key)
     {
-        auto it = m_data.find(key);
-        if (it != m_data.end())
+        Pair* pair = m_data.Find(key);
+        if (pair != nullptr)
         {
-            return &(it->second);
+            return &(pair->second);
         }
         return nullptr;
     }
@@ -67,20 +178,50 @@ public:
     /// @return Value의 const 포인터 (없으면 nullptr)
     const V* Find(const K& key) const
     {
-        auto it = m_data.find(key);
-        if (it != m_data.end())
+        const Pair* pair = m_data.Find(key);
+        if (pair != nullptr)
         {
-            return &(it->second);
+            return &(pair->second);
         }
         return nullptr;
     }
 
+    /// @brief Key와 같다고 비교되는 다른 타입으로 Value 찾기 (Hasher가 is_transparent인 경우)
+    /// @param key 찾을 키 (StringView8, 문자열 리터럴, PrehashedKey 등)
+    /// @return Value의 포인터 (없으면 nullptr)
+    /// @note 임시 Key를 만들지 않으므로 String8 Key 맵을 조회할 때 할당이 없습니다
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    V* Find(const Q& key)
+    {
+        Pair* pair = m_data.Find(key);
+        return (pair != nullptr) ? &(pair->second) : nullptr;
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 Value 찾기 (const 버전)
+    /// @param key 찾을 키 (StringView8, 문자열 리터럴, PrehashedKey 등)
+    /// @return Value의 const 포인터 (없으면 nullptr)
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    const V* Find(const Q& key) const
+    {
+        const Pair* pair = m_data.Find(key);
+        return (pair != nullptr) ? &(pair->second) : nullptr;
+    }
+
     /// @brief Key 존재 여부 확인
     /// @param key 확인할 키
     /// @return 존재하면 true, 없으면 false
     bool8 Contains(const K& key) const
     {
-        return m_data.find(key) != m_data.end();
+        return m_data.Find(key) != nullptr;
+    }
+
+    /// @brief Key와 같다고 비교되는 다른 타입으로 존재 여부 확인 (Hasher가 is_transparent인 경우)
+    /// @param key 확인할 키 (StringView8, 문자열 리터럴, PrehashedKey 등)
+    /// @return 존재하면 true, 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 Contains(const Q& key) const
+    {
+        return m_data.Find(key) != nullptr;
     }
 
     /// @brief Key로 Value 접근 (없으면 생성)
@@ -88,7 +229,9 @@ public:
     /// @return Value의 참조
     V& operator[](const K& key)
     {
-        return m_data[key];
+        Pair* pair = m_data.TryEmplace(
+            key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()).first;
+        return pair->second;
     }
 
     /// @brief Key로 Value 접근 (경계 검사, 없으면 예외)
@@ -96,7 +239,12 @@ public:
     /// @return Value의 참조
     V& GetAt(const K& key)
     {
-        return m_data.at(key);
+        V* value = Find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("HashMap::GetAt - key not found");
+        }
+        return *value;
     }
 
     /// @brief Key로 Value 접근 (경계 검사, 없으면 예외, const 버전)
@@ -104,98 +252,146 @@ public:
     /// @return Value의 const 참조
     const V& GetAt(const K& key) const
     {
-        return m_data.at(key);
+        const V* value = Find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("HashMap::GetAt - key not found");
+        }
+        return *value;
     }
 
     /// @brief 맵의 모든 요소 제거
     void Clear()
     {
-        m_data.clear();
+        m_data.Clear();
     }
 
     /// @brief 맵의 요소 개수 반환
     /// @return 요소 개수
     uint64 GetSize() const
     {
-        return static_cast<uint64>(m_data.size());
+        return m_data.GetSize();
     }
 
     /// @brief 맵이 비어있는지 확인
     /// @return 비어있으면 true, 아니면 false
     bool8 IsEmpty() const
     {
-        return m_data.empty();
+        return m_data.GetSize() == 0;
     }
 
-    /// @brief 해시맵의 버킷 용량 예약
+    /// @brief 재해시 없이 담을 수 있는 요소 개수 예약
     /// @param capacity 예약할 요소 개수
     void Reserve(uint64 capacity)
     {
-        m_data.reserve(capacity);
+        m_data.Reserve(capacity);
     }
 
-    /// @brief 모든 Key를 배열로 반환
-    /// @return Key들의 DynamicArray
-    DynamicArray<K> GetKeys() const
+    /// @brief 슬롯 배열의 용량 반환
+    /// @return 슬롯 개수 (16의 배수인 2의 거듭제곱)
+    uint64 GetCapacity() const
     {
-        DynamicArray<K> keys;
-        keys.Reserve(GetSize());
-        for (const auto& pair : m_data)
-        {
-            keys.Add(pair.first);
-        }
-        return keys;
+        return m_data.GetCapacity();
     }
 
-    /// @brief 모든 Value를 배열로 반환
-    /// @return Value들의 DynamicArray
-    DynamicArray<V> GetValues() const
+    /// @brief 최대 부하율 설정 (tombstone 포함, 초과 시 재해시)
+    /// @param loadFactor 최대 부하율 (0.25 ~ 0.9375, 기본값 0.875)
+    void SetMaxLoadFactor(float32 loadFactor)
     {
-        DynamicArray<V> values;
-        values.Reserve(GetSize());
-        for (const auto& pair : m_data)
-        {
-            values.Add(pair.second);
-        }
-        return values;
+        m_data.SetMaxLoadFactor(loadFactor);
+    }
+
+    /// @brief 최대 부하율 반환
+    /// @return 최대 부하율
+    float32 GetMaxLoadFactor() const
+    {
+        return m_data.GetMaxLoadFactor();
+    }
+
+    /// @brief 모든 Key를 복사 없이 순회하는 범위 반환
+    /// @return const K&를 돌려주는 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<KeyIterator> Keys() const
+    {
+        return MakeProjectionRange<PairFirst>(Begin(), End());
+    }
+
+    /// @brief 모든 Value를 복사 없이 순회하는 범위 반환
+    /// @return V&를 돌려주는 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<ValueIterator> Values()
+    {
+        return MakeProjectionRange<PairSecond>(Begin(), End());
+    }
+
+    /// @brief 모든 Value를 복사 없이 순회하는 범위 반환 (const 버전)
+    /// @return const V&를 돌려주는 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<ConstValueIterator> Values() const
+    {
+        return MakeProjectionRange<PairSecond>(Begin(), End());
+    }
+
+    /// @brief 모든 Key-Value 쌍을 순회하는 범위 반환
+    /// @return 맵 전체 범위 (할당 없음)
+    IteratorRange<Iterator> Items()
+    {
+        return IteratorRange<Iterator>(Begin(), End());
+    }
+
+    /// @brief 모든 Key-Value 쌍을 순회하는 범위 반환 (const 버전)
+    /// @return 맵 전체 const 범위 (할당 없음)
+    IteratorRange<ConstIterator> Items() const
+    {
+        return IteratorRange<ConstIterator>(Begin(), End());
     }
 
     /// @brief 맵의 시작 반복자 반환
     /// @return 시작 반복자
     Iterator Begin()
     {
-        return m_data.begin();
+        return Iterator(m_data.Begin());
     }
 
     /// @brief 맵의 시작 반복자 반환 (const 버전)
     /// @return const 시작 반복자
     ConstIterator Begin() const
     {
-        return m_data.begin();
+        return ConstIterator(m_data.Begin());
     }
 
     /// @brief 맵의 끝 반복자 반환
     /// @return 끝 반복자
     Iterator End()
     {
-        return m_data.end();
+        return Iterator(m_data.End());
     }
 
     /// @brief 맵의 끝 반복자 반환 (const 버전)
     /// @return const 끝 반복자
     ConstIterator End() const
     {
-        return m_data.end();
+        return ConstIterator(m_data.End());
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return m_data.GetAllocator();
     }
 
     // Range-based for loop 지원
-    Iterator begin() { return m_data.begin(); }
-    ConstIterator begin() const { return m_data.begin(); }
-    Iterator end() { return m_data.end(); }
-    ConstIterator end() const { return m_data.end(); }
+    Iterator begin() { return Begin(); }
+    ConstIterator begin() const { return Begin(); }
+    Iterator end() { return End(); }
+    ConstIterator end() const { return End(); }
 
 private:
-    std::unordered_map<K, V> m_data;
+    // 반복자로 Key를 고칠 수 없어야 함 (Key가 바뀌면 슬롯 위치와 해시가 어긋나 조회가 깨짐)
+    static_assert(std::is_same<decltype((*std::declval<Iterator>()).first), const K&>::value,
+                  "HashMap::Iterator must not expose a mutable key");
+    static_assert(std::is_same<decltype(std::declval<Iterator>()->first), const K&>::value,
+                  "HashMap::Iterator must not expose a mutable key");
+
+    Table m_data;
 };
 
 } // namespace Excep
@@ -1,31 +1,52 @@
 ﻿#pragma once
 #include "Core/Types.h"
-#include "Container/DynamicArray.h"
-#include <unordered_set>
+#include "Container/FlatHashTable.h"
+#include "Container/Hash.h"
+#include "Container/IteratorRange.h"
 #include <initializer_list>
 
 namespace Excep
 {
 
-/// @brief std::unordered_set을 래핑한 해시 기반 unique 요소 집합 컨테이너
+/// @brief Open Addressing 해시 테이블 기반 unique 요소 집합 컨테이너
 /// @tparam T 저장할 요소의 타입
-template<typename T>
+/// @tparam Hasher 해시 함수 객체 (기본값: Hash<T>)
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 노드 할당 없이 연속된 슬롯 배열에 저장합니다.
+///       삽입으로 재해시가 일어나면 반복자는 무효화됩니다.
+///       Hasher가 is_transparent를 정의하면 Contains/Remove에 T가 아닌 조회 타입을 넘길 수 있습니다.
+template<typename T, typename Hasher = Hash<T>, typename Alloc = DefaultAllocator>
 class HashSet
 {
+private:
+    using Table = FlatHashTable<T, T, IdentityKeyOf<T>, Hasher, Alloc>;
+
 public:
-    using Iterator = typename std::unordered_set<T>::iterator;
-    using ConstIterator = typename std::unordered_set<T>::const_iterator;
+    // 요소를 수정하면 해시가 바뀌므로 반복자는 항상 const 요소를 가리킴
+    using Iterator = typename Table::ConstIterator;
+    using ConstIterator = typename Table::ConstIterator;
 
     /// @brief 기본 생성자
     HashSet()
     {
     }
 
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit HashSet(const Alloc& allocator)
+        : m_data(allocator)
+    {
+    }
+
     /// @brief 초기화 리스트로 생성
     /// @param initList 초기화 리스트
     HashSet(std::initializer_list<T> initList)
-        : m_data(initList)
     {
+        m_data.Reserve(static_cast<uint64>(initList.size()));
+        for (const auto& value : initList)
+        {
+            Insert(value);
+        }
     }
 
     /// @brief 요소 삽입
@@ -33,8 +54,7 @@ public:
     /// @return 삽입 성공 시 true, 이미 존재하면 false
     bool8 Insert(const T& value)
     {
-        auto result = m_data.insert(value);
-        return result.second;
+        return m_data.TryEmplace(value, value).second;
     }
 
     /// @brief 요소 제거
@@ -42,7 +62,16 @@ public:
     /// @return 제거 성공 시 true, 요소가 없으면 false
     bool8 Remove(const T& value)
     {
-        return m_data.erase(value) > 0;
+        return m_data.Remove(value);
+    }
+
+    /// @brief 요소와 같다고 비교되는 다른 타입으로 제거 (Hasher가 is_transparent인 경우)
+    /// @param value 제거할 요소 (StringView8, 문자열 리터럴, PrehashedKey 등)
+    /// @return 제거 성공 시 true, 요소가 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 Remove(const Q& value)
+    {
+        return m_data.Remove(value);
     }
 
     /// @brief 요소 존재 여부 확인
@@ -50,85 +79,127 @@ public:
     /// @return 존재하면 true, 없으면 false
     bool8 Contains(const T& value) const
     {
-        return m_data.find(value) != m_data.end();
+        return m_data.Find(value) != nullptr;
+    }
+
+    /// @brief 요소와 같다고 비교되는 다른 타입으로 존재 여부 확인 (Hasher가 is_transparent인 경우)
+    /// @param value 확인할 요소 (StringView8, 문자열 리터럴, PrehashedKey 등)
+    /// @return 존재하면 true, 없으면 false
+    template<typename Q, typename = EnableIfTransparent<Hasher, Q>>
+    bool8 Contains(const Q& value) const
+    {
+        return m_data.Find(value) != nullptr;
+    }
+
+    /// @brief 여러 요소의 존재 여부를 한 번에 확인
+    /// @param values 확인할 요소 배열
+    /// @param count 요소 개수
+    /// @param outResults 결과 배열 (count개, i번째 요소가 있으면 true)
+    /// @note 16개씩 묶어 각 요소의 해시를 먼저 계산하고 요소마다 첫 프로브 그룹(컨트롤 바이트와 슬롯)을
+    ///       프리페치한 뒤 탐색하므로, 캐시 미스가 겹쳐 대량 확인 시 Contains 반복보다 빠릅니다
+    void ContainsMany(const T* values, uint64 count, bool8* outResults) const
+    {
+        m_data.ContainsMany(values, count, outResults);
     }
 
     /// @brief 집합의 모든 요소 제거
     void Clear()
     {
-        m_data.clear();
+        m_data.Clear();
     }
 
     /// @brief 집합의 요소 개수 반환
     /// @return 요소 개수
     uint64 GetSize() const
     {
-        return static_cast<uint64>(m_data.size());
+        return m_data.GetSize();
     }
 
     /// @brief 집합이 비어있는지 확인
     /// @return 비어있으면 true, 아니면 false
     bool8 IsEmpty() const
     {
-        return m_data.empty();
+        return m_data.GetSize() == 0;
     }
 
-    /// @brief 해시셋의 버킷 용량 예약
+    /// @brief 재해시 없이 담을 수 있는 요소 개수 예약
     /// @param capacity 예약할 요소 개수
     void Reserve(uint64 capacity)
     {
-        m_data.reserve(capacity);
+        m_data.Reserve(capacity);
     }
 
-    /// @brief 모든 요소를 배열로 반환
-    /// @return 요소들의 DynamicArray (순서 보장 없음)
-    DynamicArray<T> ToArray() const
+    /// @brief 슬롯 배열의 용량 반환
+    /// @return 슬롯 개수 (16의 배수인 2의 거듭제곱)
+    uint64 GetCapacity() const
     {
-        DynamicArray<T> array;
-        array.Reserve(GetSize());
-        for (const auto& value : m_data)
-        {
-            array.Add(value);
-        }
-        return array;
+        return m_data.GetCapacity();
+    }
+
+    /// @brief 최대 부하율 설정 (tombstone 포함, 초과 시 재해시)
+    /// @param loadFactor 최대 부하율 (0.25 ~ 0.9375, 기본값 0.875)
+    void SetMaxLoadFactor(float32 loadFactor)
+    {
+        m_data.SetMaxLoadFactor(loadFactor);
+    }
+
+    /// @brief 최대 부하율 반환
+    /// @return 최대 부하율
+    float32 GetMaxLoadFactor() const
+    {
+        return m_data.GetMaxLoadFactor();
+    }
+
+    /// @brief 모든 요소를 복사 없이 순회하는 범위 반환
+    /// @return 집합 전체 범위 (순서 보장 없음, 할당 없음, 집합을 수정하면 무효화됨)
+    IteratorRange<ConstIterator> Items() const
+    {
+        return IteratorRange<ConstIterator>(Begin(), End());
     }
 
     /// @brief 집합의 시작 반복자 반환
     /// @return 시작 반복자
     Iterator Begin()
     {
-        return m_data.begin();
+        return m_data.Begin();
     }
 
     /// @brief 집합의 시작 반복자 반환 (const 버전)
     /// @return const 시작 반복자
     ConstIterator Begin() const
     {
-        return m_data.begin();
+        return m_data.Begin();
     }
 
     /// @brief 집합의 끝 반복자 반환
     /// @return 끝 반복자
     Iterator End()
     {
-        return m_data.end();
+        return m_data.End();
     }
 
     /// @brief 집합의 끝 반복자 반환 (const 버전)
     /// @return const 끝 반복자
     ConstIterator End() const
     {
-        return m_data.end();
+        return m_data.End();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return m_data.GetAllocator();
     }
 
     // Range-based for loop 지원
-    Iterator begin() { return m_data.begin(); }
-    ConstIterator begin() const { return m_data.begin(); }
-    Iterator end() { return m_data.end(); }
-    ConstIterator end() const { return m_data.end(); }
+    Iterator begin() { return m_data.Begin(); }
+    ConstIterator begin() const { return m_data.Begin(); }
+    Iterator end() { return m_data.End(); }
+    ConstIterator end() const { return m_data.End(); }
 
 private:
-    std::unordered_set<T> m_data;
+    Table m_data;
 };
 
 } // namespace Excep
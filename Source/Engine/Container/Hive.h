@@ -0,0 +1,687 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Memory/Allocator.h"
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+namespace HiveDetail
+{
+
+/// @brief 건너뛰기 필드 값 타입 (블록 용량은 이 타입의 최댓값보다 작아야 함)
+using SkipType = uint16;
+
+/// @brief 지워진 구간 목록의 끝
+constexpr SkipType NO_RUN = 0xFFFF;
+
+/// @brief 지워진 구간의 첫 슬롯 메모리에 저장하는 구간 목록 링크
+struct FreeLinks
+{
+    SkipType prev;
+    SkipType next;
+};
+
+/// @brief 요소 슬롯과 건너뛰기 필드를 함께 할당한 블록
+/// @note skipfield[i]는 살아있는 슬롯이면 0이고, 지워진 슬롯이 연속된 구간은 첫 슬롯과 마지막 슬롯에 구간 길이를 담습니다.
+///       skipfield[capacity]는 항상 0인 경계입니다.
+template<typename Slot>
+struct Block
+{
+    Slot* slots;
+    SkipType* skipfield;
+    Block* prev;                // 순회 순서
+    Block* next;
+    Block* prevWithFree;        // 빈 슬롯이 있는 블록 목록
+    Block* nextWithFree;
+    uint64 capacity;
+    uint64 size;                // 살아있는 요소 개수
+    SkipType freeHead;          // 지워진 구간 목록의 첫 구간 시작 인덱스
+};
+
+} // namespace HiveDetail
+
+/// @brief Hive의 살아있는 요소만 순회하는 전방 반복자
+/// @tparam BlockType Hive 블록 타입
+/// @tparam ValueType 요소 타입 (const 포함)
+template<typename BlockType, typename ValueType>
+class HiveIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<ValueType>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType*;
+    using reference = ValueType&;
+
+    HiveIterator()
+        : m_block(nullptr)
+        , m_index(0)
+    {
+    }
+
+    HiveIterator(BlockType* block, uint64 index)
+        : m_block(block)
+        , m_index(index)
+    {
+    }
+
+    reference operator*() const { return *reinterpret_cast<pointer>(&m_block->slots[m_index]); }
+    pointer operator->() const { return reinterpret_cast<pointer>(&m_block->slots[m_index]); }
+
+    HiveIterator& operator++()
+    {
+        // 다음 슬롯이 지워진 구간의 시작이면 구간 길이만큼 한 번에 건너뜀
+        ++m_index;
+        m_index += m_block->skipfield[m_index];
+        if (m_index == m_block->capacity)
+        {
+            // 비어 있는 블록은 순회 목록에서 빠지므로 다음 블록에는 항상 요소가 있음
+            m_block = m_block->next;
+            m_index = (m_block != nullptr) ? m_block->skipfield[0] : 0;
+        }
+        return *this;
+    }
+
+    HiveIterator operator++(int)
+    {
+        HiveIterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    bool8 operator==(const HiveIterator& other) const { return m_block == other.m_block && m_index == other.m_index; }
+    bool8 operator!=(const HiveIterator& other) const { return !(*this == other); }
+
+private:
+    template<typename, typename>
+    friend class Hive;
+
+    BlockType* m_block;
+    uint64 m_index;
+};
+
+/// @brief 생성/제거가 잦은 객체를 위한 블록 기반 컨테이너 (colony)
+/// @tparam T 저장할 요소의 타입
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 요소는 크기가 점점 커지는 블록(MIN_BLOCK_CAPACITY ~ MAX_BLOCK_CAPACITY)에 저장되며 절대 이동하지 않으므로
+///       포인터와 반복자는 그 요소가 제거될 때까지 유효합니다.
+///       제거는 O(1)로 슬롯만 비우고, 삽입은 O(1)로 지워진 슬롯을 먼저 재사용합니다.
+///       순회는 건너뛰기 필드(jump-counting skipfield)로 지워진 구간을 한 번에 건너뜁니다.
+///       비어 버린 블록과 Clear한 블록은 해제하지 않고 보관했다가 재사용하므로, 매 프레임 수천 개가
+///       생기고 사라지는 파티클/투사체도 안정 상태에서는 할당자를 호출하지 않습니다 (반환하려면 Trim).
+///       인덱스 접근은 제공하지 않으며, 순서는 삽입 순서와 다를 수 있습니다.
+template<typename T, typename Alloc = DefaultAllocator>
+class Hive : private Alloc
+{
+private:
+    using SkipType = HiveDetail::SkipType;
+    using FreeLinks = HiveDetail::FreeLinks;
+    static constexpr uint64 SLOT_SIZE = (sizeof(T) > sizeof(FreeLinks)) ? sizeof(T) : sizeof(FreeLinks);
+    static constexpr uint64 SLOT_ALIGNMENT = (alignof(T) > alignof(FreeLinks)) ? alignof(T) : alignof(FreeLinks);
+
+    // 지워진 슬롯에는 구간 목록 링크를 저장하므로 슬롯은 FreeLinks보다 작을 수 없음
+    using Slot = typename std::aligned_storage<SLOT_SIZE, SLOT_ALIGNMENT>::type;
+    using Block = HiveDetail::Block<Slot>;
+
+public:
+    using Iterator = HiveIterator<Block, T>;
+    using ConstIterator = HiveIterator<Block, const T>;
+
+    /// @brief 첫 블록의 용량
+    static constexpr uint64 MIN_BLOCK_CAPACITY = 8;
+
+    /// @brief 블록 용량의 상한 (블록마다 두 배씩 커지다가 이 값에서 멈춤)
+    static constexpr uint64 MAX_BLOCK_CAPACITY = 8192;
+
+    /// @brief 기본 생성자
+    Hive()
+        : m_firstBlock(nullptr)
+        , m_lastBlock(nullptr)
+        , m_firstFreeBlock(nullptr)
+        , m_unusedBlocks(nullptr)
+        , m_size(0)
+        , m_capacity(0)
+        , m_nextBlockCapacity(MIN_BLOCK_CAPACITY)
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit Hive(const Alloc& allocator)
+        : Alloc(allocator)
+        , m_firstBlock(nullptr)
+        , m_lastBlock(nullptr)
+        , m_firstFreeBlock(nullptr)
+        , m_unusedBlocks(nullptr)
+        , m_size(0)
+        , m_capacity(0)
+        , m_nextBlockCapacity(MIN_BLOCK_CAPACITY)
+    {
+    }
+
+    /// @brief 복사 생성자 (요소를 순회 순서대로 복사)
+    /// @param other 복사할 Hive
+    Hive(const Hive& other)
+        : Hive(other.GetAllocator())
+    {
+        Reserve(other.m_size);
+        for (const T& value : other)
+        {
+            Insert(value);
+        }
+    }
+
+    /// @brief 이동 생성자 (블록을 넘겨받음)
+    /// @param other 이동할 Hive
+    Hive(Hive&& other) noexcept
+        : Hive(other.GetAllocator())
+    {
+        TakeBlocks(other);
+    }
+
+    ~Hive()
+    {
+        Clear();
+        Trim();
+    }
+
+    /// @brief 복사 대입 연산자
+    /// @param other 복사할 Hive
+    /// @return 자기 자신의 참조
+    Hive& operator=(const Hive& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            Reserve(other.m_size);
+            for (const T& value : other)
+            {
+                Insert(value);
+            }
+        }
+        return *this;
+    }
+
+    /// @brief 이동 대입 연산자
+    /// @param other 이동할 Hive
+    /// @return 자기 자신의 참조
+    Hive& operator=(Hive&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            Trim();
+            static_cast<Alloc&>(*this) = other.GetAllocator();
+            TakeBlocks(other);
+        }
+        return *this;
+    }
+
+    /// @brief 요소 추가 (지워진 슬롯이 있으면 재사용)
+    /// @param value 추가할 요소
+    /// @return 추가된 요소의 반복자
+    Iterator Insert(const T& value)
+    {
+        return Emplace(value);
+    }
+
+    /// @brief 요소 추가 (move semantics)
+    /// @param value 추가할 요소
+    /// @return 추가된 요소의 반복자
+    Iterator Insert(T&& value)
+    {
+        return Emplace(std::move(value));
+    }
+
+    /// @brief 요소를 제자리 생성하여 추가 (지워진 슬롯이 있으면 재사용)
+    /// @param args 요소 생성자 인자
+    /// @return 추가된 요소의 반복자
+    template<typename... Args>
+    Iterator Emplace(Args&&... args)
+    {
+        if (m_firstFreeBlock == nullptr)
+        {
+            ActivateBlock(AcquireBlock());
+        }
+
+        // 빈 슬롯이 있는 블록에서 첫 번째 지워진 구간의 시작 슬롯을 사용
+        Block* block = m_firstFreeBlock;
+        const uint64 index = block->freeHead;
+        const FreeLinks links = GetLinks(block, index);
+        try
+        {
+            new (&block->slots[index]) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            new (&block->slots[index]) FreeLinks(links);
+            if (block->size == 0)
+            {
+                DeactivateBlock(block);
+            }
+            throw;
+        }
+
+        SkipType* skipfield = block->skipfield;
+        const uint64 runLength = skipfield[index];
+        if (runLength == 1)
+        {
+            UnlinkRun(block, links);
+        }
+        else
+        {
+            // 구간의 시작을 한 칸 뒤로 옮김
+            const uint64 newStart = index + 1;
+            RelinkRun(block, links, newStart);
+            skipfield[newStart] = static_cast<SkipType>(runLength - 1);
+            skipfield[index + runLength - 1] = static_cast<SkipType>(runLength - 1);
+        }
+        skipfield[index] = 0;
+
+        ++block->size;
+        ++m_size;
+        return Iterator(block, index);
+    }
+
+    /// @brief 반복자가 가리키는 요소 제거 (다른 요소는 이동하지 않음)
+    /// @param it 제거할 요소의 반복자
+    /// @return 제거된 요소 다음 요소의 반복자
+    Iterator Erase(Iterator it)
+    {
+        Iterator next = it;
+        ++next;
+
+        Block* block = it.m_block;
+        const uint64 index = it.m_index;
+        reinterpret_cast<T*>(&block->slots[index])->~T();
+        --block->size;
+        --m_size;
+
+        if (block->size == 0)
+        {
+            DeactivateBlock(block);
+            return next;
+        }
+
+        // 양옆의 지워진 구간과 합침 (왼쪽 이웃은 구간의 끝, 오른쪽 이웃은 구간의 시작)
+        SkipType* skipfield = block->skipfield;
+        const uint64 left = (index > 0) ? skipfield[index - 1] : 0;
+        const uint64 right = skipfield[index + 1];
+        if (left == 0 && right == 0)
+        {
+            skipfield[index] = 1;
+            PushRun(block, index);
+        }
+        else if (right == 0)
+        {
+            const SkipType length = static_cast<SkipType>(left + 1);
+            skipfield[index - left] = length;
+            skipfield[index] = length;
+        }
+        else if (left == 0)
+        {
+            const SkipType length = static_cast<SkipType>(right + 1);
+            RelinkRun(block, GetLinks(block, index + 1), index);
+            skipfield[index] = length;
+            skipfield[index + right] = length;
+        }
+        else
+        {
+            const SkipType length = static_cast<SkipType>(left + 1 + right);
+            UnlinkRun(block, GetLinks(block, index + 1));
+            skipfield[index - left] = length;
+            skipfield[index + right] = length;
+        }
+        return next;
+    }
+
+    /// @brief 요소 포인터로 반복자를 찾음 (O(블록 수))
+    /// @param element Hive 안의 요소 포인터
+    /// @return 요소의 반복자 (Hive의 살아있는 요소가 아니면 End())
+    Iterator GetIterator(const T* element)
+    {
+        const Slot* slot = reinterpret_cast<const Slot*>(element);
+        for (Block* block = m_firstBlock; block != nullptr; block = block->next)
+        {
+            if (slot >= block->slots && slot < block->slots + block->capacity)
+            {
+                const uint64 index = static_cast<uint64>(slot - block->slots);
+                return (block->skipfield[index] == 0) ? Iterator(block, index) : End();
+            }
+        }
+        return End();
+    }
+
+    /// @brief 모든 요소 제거 (블록은 해제하지 않고 재사용을 위해 보관)
+    void Clear()
+    {
+        while (m_firstBlock != nullptr)
+        {
+            Block* block = m_firstBlock;
+            for (Iterator it(block, block->skipfield[0]); it.m_block == block; ++it)
+            {
+                it->~T();
+            }
+            block->size = 0;
+            DeactivateBlock(block);
+        }
+        m_size = 0;
+    }
+
+    /// @brief 최소 capacity개를 추가 할당 없이 담을 수 있도록 블록을 미리 할당
+    /// @param capacity 예약할 요소 개수
+    void Reserve(uint64 capacity)
+    {
+        while (m_capacity < capacity)
+        {
+            Block* block = AllocateBlock();
+            block->next = m_unusedBlocks;
+            m_unusedBlocks = block;
+        }
+    }
+
+    /// @brief 보관 중인 빈 블록을 모두 해제
+    void Trim()
+    {
+        while (m_unusedBlocks != nullptr)
+        {
+            Block* block = m_unusedBlocks;
+            m_unusedBlocks = block->next;
+            FreeBlock(block);
+        }
+    }
+
+    /// @brief 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_size;
+    }
+
+    /// @brief 할당된 슬롯 개수 반환 (보관 중인 빈 블록 포함)
+    /// @return 추가 할당 없이 담을 수 있는 요소 개수
+    uint64 GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// @brief 첫 번째 요소의 반복자 반환
+    /// @return 시작 반복자
+    Iterator Begin()
+    {
+        return (m_firstBlock != nullptr) ? Iterator(m_firstBlock, m_firstBlock->skipfield[0]) : End();
+    }
+
+    /// @brief 첫 번째 요소의 반복자 반환 (const 버전)
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return (m_firstBlock != nullptr) ? ConstIterator(m_firstBlock, m_firstBlock->skipfield[0]) : End();
+    }
+
+    /// @brief 끝 반복자 반환
+    /// @return 끝 반복자
+    Iterator End()
+    {
+        return Iterator();
+    }
+
+    /// @brief 끝 반복자 반환 (const 버전)
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return ConstIterator();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return *this;
+    }
+
+    // Range-based for loop 지원
+    Iterator begin() { return Begin(); }
+    ConstIterator begin() const { return Begin(); }
+    Iterator end() { return End(); }
+    ConstIterator end() const { return End(); }
+
+private:
+    static uint64 GetHeaderSize()
+    {
+        return (sizeof(Block) + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+    }
+
+    static uint64 GetBlockBytes(uint64 capacity)
+    {
+        return GetHeaderSize() + capacity * sizeof(Slot) + (capacity + 1) * sizeof(SkipType);
+    }
+
+    static uint64 GetBlockAlignment()
+    {
+        return (alignof(Block) > alignof(Slot)) ? alignof(Block) : alignof(Slot);
+    }
+
+    static FreeLinks& GetLinks(Block* block, uint64 index)
+    {
+        return *reinterpret_cast<FreeLinks*>(&block->slots[index]);
+    }
+
+    /// @brief 블록 하나를 할당 (용량은 MAX_BLOCK_CAPACITY까지 두 배씩 증가)
+    Block* AllocateBlock()
+    {
+        const uint64 capacity = m_nextBlockCapacity;
+        if (m_nextBlockCapacity * 2 <= MAX_BLOCK_CAPACITY)
+        {
+            m_nextBlockCapacity *= 2;
+        }
+
+        uint8* memory = static_cast<uint8*>(Alloc::Allocate(GetBlockBytes(capacity), GetBlockAlignment()));
+        Block* block = new (memory) Block();
+        block->slots = reinterpret_cast<Slot*>(memory + GetHeaderSize());
+        block->skipfield = reinterpret_cast<SkipType*>(block->slots + capacity);
+        block->capacity = capacity;
+        m_capacity += capacity;
+        return block;
+    }
+
+    void FreeBlock(Block* block)
+    {
+        m_capacity -= block->capacity;
+        Alloc::Deallocate(block, GetBlockBytes(block->capacity), GetBlockAlignment());
+    }
+
+    /// @brief 보관 중인 빈 블록을 꺼내거나 새로 할당
+    Block* AcquireBlock()
+    {
+        if (m_unusedBlocks != nullptr)
+        {
+            Block* block = m_unusedBlocks;
+            m_unusedBlocks = block->next;
+            return block;
+        }
+        return AllocateBlock();
+    }
+
+    /// @brief 빈 블록을 전체가 지워진 구간 하나인 상태로 초기화하고 순회 목록 끝에 추가
+    void ActivateBlock(Block* block)
+    {
+        const uint64 capacity = block->capacity;
+        block->skipfield[0] = static_cast<SkipType>(capacity);
+        block->skipfield[capacity - 1] = static_cast<SkipType>(capacity);
+        block->skipfield[capacity] = 0;
+        block->size = 0;
+        block->freeHead = HiveDetail::NO_RUN;
+
+        block->prev = m_lastBlock;
+        block->next = nullptr;
+        if (m_lastBlock != nullptr)
+        {
+            m_lastBlock->next = block;
+        }
+        else
+        {
+            m_firstBlock = block;
+        }
+        m_lastBlock = block;
+
+        PushRun(block, 0);
+    }
+
+    /// @brief 비어 버린 블록을 순회/빈 슬롯 목록에서 빼고 보관 목록에 넣음
+    void DeactivateBlock(Block* block)
+    {
+        if (block->freeHead != HiveDetail::NO_RUN)
+        {
+            RemoveFreeBlock(block);
+        }
+
+        if (block->prev != nullptr)
+        {
+            block->prev->next = block->next;
+        }
+        else
+        {
+            m_firstBlock = block->next;
+        }
+
+        if (block->next != nullptr)
+        {
+            block->next->prev = block->prev;
+        }
+        else
+        {
+            m_lastBlock = block->prev;
+        }
+
+        block->next = m_unusedBlocks;
+        m_unusedBlocks = block;
+    }
+
+    /// @brief start에서 시작하는 지워진 구간을 블록의 구간 목록 앞에 추가
+    void PushRun(Block* block, uint64 start)
+    {
+        const SkipType head = block->freeHead;
+        new (&block->slots[start]) FreeLinks{ HiveDetail::NO_RUN, head };
+        if (head != HiveDetail::NO_RUN)
+        {
+            GetLinks(block, head).prev = static_cast<SkipType>(start);
+        }
+        else
+        {
+            AddFreeBlock(block);
+        }
+        block->freeHead = static_cast<SkipType>(start);
+    }
+
+    /// @brief links를 가진 구간을 구간 목록에서 제거
+    void UnlinkRun(Block* block, const FreeLinks links)
+    {
+        if (links.prev != HiveDetail::NO_RUN)
+        {
+            GetLinks(block, links.prev).next = links.next;
+        }
+        else
+        {
+            block->freeHead = links.next;
+        }
+
+        if (links.next != HiveDetail::NO_RUN)
+        {
+            GetLinks(block, links.next).prev = links.prev;
+        }
+
+        if (block->freeHead == HiveDetail::NO_RUN)
+        {
+            RemoveFreeBlock(block);
+        }
+    }
+
+    /// @brief links를 가진 구간의 시작을 newStart로 옮김 (목록 순서 유지)
+    void RelinkRun(Block* block, const FreeLinks links, uint64 newStart)
+    {
+        new (&block->slots[newStart]) FreeLinks(links);
+        if (links.prev != HiveDetail::NO_RUN)
+        {
+            GetLinks(block, links.prev).next = static_cast<SkipType>(newStart);
+        }
+        else
+        {
+            block->freeHead = static_cast<SkipType>(newStart);
+        }
+
+        if (links.next != HiveDetail::NO_RUN)
+        {
+            GetLinks(block, links.next).prev = static_cast<SkipType>(newStart);
+        }
+    }
+
+    void AddFreeBlock(Block* block)
+    {
+        block->prevWithFree = nullptr;
+        block->nextWithFree = m_firstFreeBlock;
+        if (m_firstFreeBlock != nullptr)
+        {
+            m_firstFreeBlock->prevWithFree = block;
+        }
+        m_firstFreeBlock = block;
+    }
+
+    void RemoveFreeBlock(Block* block)
+    {
+        if (block->prevWithFree != nullptr)
+        {
+            block->prevWithFree->nextWithFree = block->nextWithFree;
+        }
+        else
+        {
+            m_firstFreeBlock = block->nextWithFree;
+        }
+
+        if (block->nextWithFree != nullptr)
+        {
+            block->nextWithFree->prevWithFree = block->prevWithFree;
+        }
+    }
+
+    void TakeBlocks(Hive& other)
+    {
+        m_firstBlock = other.m_firstBlock;
+        m_lastBlock = other.m_lastBlock;
+        m_firstFreeBlock = other.m_firstFreeBlock;
+        m_unusedBlocks = other.m_unusedBlocks;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        m_nextBlockCapacity = other.m_nextBlockCapacity;
+
+        other.m_firstBlock = nullptr;
+        other.m_lastBlock = nullptr;
+        other.m_firstFreeBlock = nullptr;
+        other.m_unusedBlocks = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+        other.m_nextBlockCapacity = MIN_BLOCK_CAPACITY;
+    }
+
+    Block* m_firstBlock;        // 순회 순서의 첫 블록 (요소가 있는 블록만)
+    Block* m_lastBlock;
+    Block* m_firstFreeBlock;    // 빈 슬롯이 있는 블록 목록
+    Block* m_unusedBlocks;      // 재사용을 위해 보관 중인 빈 블록 (next로 연결)
+    uint64 m_size;
+    uint64 m_capacity;
+    uint64 m_nextBlockCapacity;
+};
+
+} // namespace Excep
@@ -0,0 +1,395 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <cassert>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 최대 N개의 요소를 객체 내부에만 저장하는 고정 용량 동적 배열 컨테이너
+/// @tparam T 저장할 요소의 타입
+/// @tparam N 최대 요소 개수 (객체 내부 저장 용량)
+/// @note StaticArray와 달리 현재 크기를 따로 두고, 요소는 추가할 때 생성하고 제거할 때 소멸합니다.
+///       DynamicArray와 같은 API를 제공하지만 힙을 전혀 사용하지 않으며, 용량을 넘겨 추가하면 디버그 빌드에서 assert합니다.
+///       요소 개수의 상한이 정해진 목록(프레임 임시 목록, 커맨드 패킷 등)에 사용합니다.
+template<typename T, uint64 N>
+class InplaceArray
+{
+public:
+    static_assert(N > 0, "InplaceArray capacity must be greater than 0");
+
+    using Iterator = T*;
+    using ConstIterator = const T*;
+
+    /// @brief 기본 생성자
+    InplaceArray()
+        : m_size(0)
+    {
+    }
+
+    /// @brief 크기를 지정하여 생성
+    /// @param size 초기 크기 (N 이하)
+    explicit InplaceArray(uint64 size)
+        : InplaceArray()
+    {
+        Resize(size);
+    }
+
+    /// @brief 크기와 초기값을 지정하여 생성
+    /// @param size 초기 크기 (N 이하)
+    /// @param value 초기값
+    InplaceArray(uint64 size, const T& value)
+        : InplaceArray()
+    {
+        Resize(size, value);
+    }
+
+    /// @brief 초기화 리스트로 생성
+    /// @param initList 초기화 리스트 (N개 이하)
+    InplaceArray(std::initializer_list<T> initList)
+        : InplaceArray()
+    {
+        for (const auto& value : initList)
+        {
+            Add(value);
+        }
+    }
+
+    /// @brief 복사 생성자
+    /// @param other 복사할 InplaceArray
+    InplaceArray(const InplaceArray& other)
+        : InplaceArray()
+    {
+        for (uint64 i = 0; i < other.m_size; ++i)
+        {
+            new (GetData() + i) T(other[i]);
+        }
+        m_size = other.m_size;
+    }
+
+    /// @brief 이동 생성자 (요소를 하나씩 이동, other는 비워짐)
+    /// @param other 이동할 InplaceArray
+    InplaceArray(InplaceArray&& other) noexcept
+        : InplaceArray()
+    {
+        for (uint64 i = 0; i < other.m_size; ++i)
+        {
+            new (GetData() + i) T(std::move(other[i]));
+        }
+        m_size = other.m_size;
+        other.Clear();
+    }
+
+    ~InplaceArray()
+    {
+        Clear();
+    }
+
+    /// @brief 복사 대입 연산자
+    /// @param other 복사할 InplaceArray
+    /// @return 자기 자신의 참조
+    InplaceArray& operator=(const InplaceArray& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            for (uint64 i = 0; i < other.m_size; ++i)
+            {
+                new (GetData() + i) T(other[i]);
+            }
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    /// @brief 이동 대입 연산자 (other는 비워짐)
+    /// @param other 이동할 InplaceArray
+    /// @return 자기 자신의 참조
+    InplaceArray& operator=(InplaceArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            for (uint64 i = 0; i < other.m_size; ++i)
+            {
+                new (GetData() + i) T(std::move(other[i]));
+            }
+            m_size = other.m_size;
+            other.Clear();
+        }
+        return *this;
+    }
+
+    /// @brief 배열 끝에 요소 추가
+    /// @param value 추가할 요소
+    void Add(const T& value)
+    {
+        assert(m_size < N && "InplaceArray::Add - capacity exceeded");
+        new (GetData() + m_size) T(value);
+        ++m_size;
+    }
+
+    /// @brief 배열 끝에 요소 추가 (move semantics)
+    /// @param value 추가할 요소
+    void Add(T&& value)
+    {
+        assert(m_size < N && "InplaceArray::Add - capacity exceeded");
+        new (GetData() + m_size) T(std::move(value));
+        ++m_size;
+    }
+
+    /// @brief 배열 끝에 요소를 제자리 생성
+    /// @param args 요소 생성자 인자
+    /// @return 생성된 요소의 참조
+    template<typename... Args>
+    T& Emplace(Args&&... args)
+    {
+        assert(m_size < N && "InplaceArray::Emplace - capacity exceeded");
+        T* element = new (GetData() + m_size) T(std::forward<Args>(args)...);
+        ++m_size;
+        return *element;
+    }
+
+    /// @brief 특정 값을 가진 첫 번째 요소 제거
+    /// @param value 제거할 값
+    /// @return 제거 성공 시 true, 값을 찾지 못한 경우 false
+    bool8 Remove(const T& value)
+    {
+        for (uint64 i = 0; i < m_size; ++i)
+        {
+            if ((*this)[i] == value)
+            {
+                RemoveAt(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief 특정 인덱스의 요소 제거 (뒤의 요소들은 한 칸씩 당겨짐)
+    /// @param index 제거할 요소의 인덱스
+    void RemoveAt(uint64 index)
+    {
+        T* data = GetData();
+        for (uint64 i = index; i + 1 < m_size; ++i)
+        {
+            data[i] = std::move(data[i + 1]);
+        }
+        Pop();
+    }
+
+    /// @brief 특정 인덱스의 요소를 마지막 요소와 바꾼 뒤 제거 (순서 유지 안 함, O(1))
+    /// @param index 제거할 요소의 인덱스
+    void RemoveAtSwap(uint64 index)
+    {
+        T* data = GetData();
+        if (index + 1 < m_size)
+        {
+            data[index] = std::move(data[m_size - 1]);
+        }
+        Pop();
+    }
+
+    /// @brief 마지막 요소 제거
+    void Pop()
+    {
+        assert(m_size > 0 && "InplaceArray::Pop - array is empty");
+        --m_size;
+        GetData()[m_size].~T();
+    }
+
+    /// @brief 배열의 모든 요소 제거
+    void Clear()
+    {
+        T* data = GetData();
+        for (uint64 i = 0; i < m_size; ++i)
+        {
+            data[i].~T();
+        }
+        m_size = 0;
+    }
+
+    /// @brief 배열의 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_size;
+    }
+
+    /// @brief 배열의 용량 반환
+    /// @return 담을 수 있는 최대 요소 개수 (컴파일 타임 상수)
+    static constexpr uint64 GetCapacity()
+    {
+        return N;
+    }
+
+    /// @brief 배열이 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// @brief 배열이 가득 찼는지 확인
+    /// @return 요소 개수가 N이면 true
+    bool8 IsFull() const
+    {
+        return m_size == N;
+    }
+
+    /// @brief 배열의 크기 변경
+    /// @param newSize 새로운 크기 (N 이하)
+    void Resize(uint64 newSize)
+    {
+        assert(newSize <= N && "InplaceArray::Resize - capacity exceeded");
+        while (m_size > newSize)
+        {
+            Pop();
+        }
+        for (; m_size < newSize; ++m_size)
+        {
+            new (GetData() + m_size) T();
+        }
+    }
+
+    /// @brief 배열의 크기 변경 (기본값 지정)
+    /// @param newSize 새로운 크기 (N 이하)
+    /// @param value 새로 추가되는 요소의 기본값
+    void Resize(uint64 newSize, const T& value)
+    {
+        assert(newSize <= N && "InplaceArray::Resize - capacity exceeded");
+        while (m_size > newSize)
+        {
+            Pop();
+        }
+        for (; m_size < newSize; ++m_size)
+        {
+            new (GetData() + m_size) T(value);
+        }
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 없음)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 참조
+    T& operator[](uint64 index)
+    {
+        return GetData()[index];
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 없음, const 버전)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 const 참조
+    const T& operator[](uint64 index) const
+    {
+        return GetData()[index];
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 수행)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 참조
+    T& GetAt(uint64 index)
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("InplaceArray::GetAt - index out of range");
+        }
+        return GetData()[index];
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 수행, const 버전)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 const 참조
+    const T& GetAt(uint64 index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("InplaceArray::GetAt - index out of range");
+        }
+        return GetData()[index];
+    }
+
+    /// @brief 배열의 첫 번째 요소 참조 반환
+    /// @return 첫 번째 요소의 참조
+    T& GetFront()
+    {
+        return GetData()[0];
+    }
+
+    /// @brief 배열의 첫 번째 요소 참조 반환 (const 버전)
+    /// @return 첫 번째 요소의 const 참조
+    const T& GetFront() const
+    {
+        return GetData()[0];
+    }
+
+    /// @brief 배열의 마지막 요소 참조 반환
+    /// @return 마지막 요소의 참조
+    T& GetBack()
+    {
+        return GetData()[m_size - 1];
+    }
+
+    /// @brief 배열의 마지막 요소 참조 반환 (const 버전)
+    /// @return 마지막 요소의 const 참조
+    const T& GetBack() const
+    {
+        return GetData()[m_size - 1];
+    }
+
+    /// @brief 배열의 원시 데이터 포인터 반환
+    /// @return 배열의 첫 번째 요소를 가리키는 포인터
+    T* GetData()
+    {
+        return reinterpret_cast<T*>(m_storage);
+    }
+
+    /// @brief 배열의 원시 데이터 포인터 반환 (const 버전)
+    /// @return 배열의 첫 번째 요소를 가리키는 const 포인터
+    const T* GetData() const
+    {
+        return reinterpret_cast<const T*>(m_storage);
+    }
+
+    /// @brief 배열의 시작 반복자 반환
+    /// @return 시작 반복자
+    Iterator Begin()
+    {
+        return GetData();
+    }
+
+    /// @brief 배열의 시작 반복자 반환 (const 버전)
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return GetData();
+    }
+
+    /// @brief 배열의 끝 반복자 반환
+    /// @return 끝 반복자
+    Iterator End()
+    {
+        return GetData() + m_size;
+    }
+
+    /// @brief 배열의 끝 반복자 반환 (const 버전)
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return GetData() + m_size;
+    }
+
+    // Range-based for loop 지원
+    Iterator begin() { return GetData(); }
+    ConstIterator begin() const { return GetData(); }
+    Iterator end() { return GetData() + m_size; }
+    ConstIterator end() const { return GetData() + m_size; }
+
+private:
+    uint64 m_size;
+    alignas(T) uint8 m_storage[N * sizeof(T)];
+};
+
+} // namespace Excep
@@ -0,0 +1,142 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 반복자 쌍 [Begin, End)를 하나의 범위로 묶는 래퍼
+/// @tparam It 반복자 타입
+/// @note 컨테이너의 부분 범위를 range-based for로 순회할 때 사용합니다
+template<typename It>
+class IteratorRange
+{
+public:
+    /// @brief 반복자 쌍으로 생성
+    /// @param first 시작 반복자
+    /// @param last 끝 반복자
+    IteratorRange(It first, It last)
+        : m_begin(first)
+        , m_end(last)
+    {
+    }
+
+    /// @brief 범위의 시작 반복자 반환
+    /// @return 시작 반복자
+    It Begin() const
+    {
+        return m_begin;
+    }
+
+    /// @brief 범위의 끝 반복자 반환
+    /// @return 끝 반복자
+    It End() const
+    {
+        return m_end;
+    }
+
+    /// @brief 범위가 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_begin == m_end;
+    }
+
+    // Range-based for loop 지원
+    It begin() const { return m_begin; }
+    It end() const { return m_end; }
+
+private:
+    It m_begin;
+    It m_end;
+};
+
+/// @brief 기반 반복자가 가리키는 요소의 일부를 돌려주는 반복자 어댑터
+/// @tparam It 기반 반복자 타입
+/// @tparam Projection 요소에서 참조를 꺼내는 정책 (static R& Get(요소 참조))
+/// @note 맵의 Keys()/Values()처럼 요소를 복사하지 않고 멤버 하나만 순회할 때 사용합니다
+template<typename It, typename Projection>
+class ProjectionIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using reference = decltype(Projection::Get(*std::declval<const It&>()));
+    using value_type = typename std::decay<reference>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::remove_reference<reference>::type*;
+
+    ProjectionIterator()
+        : m_it()
+    {
+    }
+
+    explicit ProjectionIterator(It it)
+        : m_it(it)
+    {
+    }
+
+    /// @brief 기반 반복자 반환
+    /// @return 기반 반복자
+    It GetBase() const
+    {
+        return m_it;
+    }
+
+    reference operator*() const { return Projection::Get(*m_it); }
+    pointer operator->() const { return &Projection::Get(*m_it); }
+
+    ProjectionIterator& operator++()
+    {
+        ++m_it;
+        return *this;
+    }
+
+    ProjectionIterator operator++(int)
+    {
+        ProjectionIterator temp(*this);
+        ++m_it;
+        return temp;
+    }
+
+    bool8 operator==(const ProjectionIterator& other) const { return m_it == other.m_it; }
+    bool8 operator!=(const ProjectionIterator& other) const { return m_it != other.m_it; }
+
+private:
+    It m_it;
+};
+
+/// @brief pair(또는 참조 쌍)의 first를 꺼내는 정책 (맵의 Key 순회용)
+struct PairFirst
+{
+    template<typename Pair>
+    static auto Get(Pair&& pair) -> decltype((pair.first))
+    {
+        return pair.first;
+    }
+};
+
+/// @brief pair(또는 참조 쌍)의 second를 꺼내는 정책 (맵의 Value 순회용)
+struct PairSecond
+{
+    template<typename Pair>
+    static auto Get(Pair&& pair) -> decltype((pair.second))
+    {
+        return pair.second;
+    }
+};
+
+/// @brief 기반 반복자 범위를 Projection을 적용한 범위로 변환
+/// @param first 시작 반복자
+/// @param last 끝 반복자
+/// @return ProjectionIterator 범위
+template<typename Projection, typename It>
+IteratorRange<ProjectionIterator<It, Projection>> MakeProjectionRange(It first, It last)
+{
+    return IteratorRange<ProjectionIterator<It, Projection>>(
+        ProjectionIterator<It, Projection>(first), ProjectionIterator<It, Projection>(last));
+}
+
+} // namespace Excep
@@ -0,0 +1,324 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/HashMap.h"
+#include "Container/StableArray.h"
+#include "Container/Hash.h"
+#include "Memory/Allocator.h"
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 항목 비용을 Key와 Value의 크기로 계산하는 기본 비용 함수
+struct LruSizeOfCost
+{
+    template<typename K, typename V>
+    uint64 operator()(const K&, const V&) const
+    {
+        return sizeof(K) + sizeof(V);
+    }
+};
+
+/// @brief 축출 시 아무 일도 하지 않는 기본 콜백
+struct LruNoEvictCallback
+{
+    template<typename K, typename V>
+    void operator()(const K&, V&) const
+    {
+    }
+};
+
+/// @brief 비용 예산을 넘으면 가장 오래 사용하지 않은 항목부터 축출하는 캐시 (LRU)
+/// @tparam K Key 타입
+/// @tparam V Value 타입
+/// @tparam CostOf (const K&, const V&) → uint64 항목 비용(바이트 등)을 반환하는 함수 객체
+/// @tparam OnEvict (const K&, V&)를 받는 축출 콜백 (예산 초과로 축출될 때만 호출, 같은 캐시에 접근하면 안 됨)
+/// @tparam Hasher 해시 함수 객체 (기본값: Hash<K>)
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 항목은 StableArray 슬롯에 저장하고 슬롯 인덱스로 이중 연결 리스트(최근 사용 순)를 구성하며,
+///       HashMap이 Key → 슬롯 인덱스를 찾으므로 Get/Put/축출이 모두 O(1)입니다.
+///       Get이 반환한 포인터는 항목이 축출/제거되기 전까지 유효합니다 (슬롯은 이동하지 않음).
+template<typename K, typename V, typename CostOf = LruSizeOfCost, typename OnEvict = LruNoEvictCallback,
+         typename Hasher = Hash<K>, typename Alloc = DefaultAllocator>
+class LruCache
+{
+public:
+    /// @brief 생성자
+    /// @param budget 전체 비용 예산 (항목 비용의 합이 이 값을 넘으면 축출)
+    /// @param costOf 비용 함수 객체
+    /// @param onEvict 축출 콜백
+    /// @param allocator 사용할 할당자
+    explicit LruCache(uint64 budget, const CostOf& costOf = CostOf(), const OnEvict& onEvict = OnEvict(),
+                      const Alloc& allocator = Alloc())
+        : m_nodes(allocator)
+        , m_indices(allocator)
+        , m_costOf(costOf)
+        , m_onEvict(onEvict)
+        , m_budget(budget)
+        , m_totalCost(0)
+        , m_head(INVALID_INDEX)
+        , m_tail(INVALID_INDEX)
+    {
+    }
+
+    // 노드 인덱스로 연결된 리스트를 가지므로 복사 불가
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    /// @brief Key의 Value를 찾고 가장 최근 사용으로 표시
+    /// @param key 찾을 키
+    /// @return Value 포인터 (없으면 nullptr)
+    V* Get(const K& key)
+    {
+        const uint64* index = m_indices.Find(key);
+        if (index == nullptr)
+        {
+            return nullptr;
+        }
+
+        MoveToFront(*index);
+        return &m_nodes[*index].value;
+    }
+
+    /// @brief Key의 Value를 사용 순서를 바꾸지 않고 찾음
+    /// @param key 찾을 키
+    /// @return Value의 const 포인터 (없으면 nullptr)
+    const V* Peek(const K& key) const
+    {
+        const uint64* index = m_indices.Find(key);
+        return (index != nullptr) ? &m_nodes[*index].value : nullptr;
+    }
+
+    /// @brief Key 존재 여부 확인 (사용 순서는 바뀌지 않음)
+    /// @param key 확인할 키
+    /// @return 존재하면 true, 없으면 false
+    bool8 Contains(const K& key) const
+    {
+        return m_indices.Contains(key);
+    }
+
+    /// @brief Key-Value를 넣고 가장 최근 사용으로 표시 (이미 있으면 Value와 비용을 갱신)
+    /// @param key 키
+    /// @param value 값
+    /// @return 저장된 Value의 참조
+    /// @note 넣은 뒤 비용이 예산을 넘으면 가장 오래된 항목부터 축출합니다.
+    ///       방금 넣은 항목은 축출하지 않으므로, 항목 하나의 비용이 예산보다 크면 그 항목만 남습니다.
+    V& Put(const K& key, const V& value)
+    {
+        return PutImpl(key, value);
+    }
+
+    /// @brief Key-Value를 넣고 가장 최근 사용으로 표시 (move semantics)
+    /// @param key 키
+    /// @param value 값
+    /// @return 저장된 Value의 참조
+    V& Put(const K& key, V&& value)
+    {
+        return PutImpl(key, std::move(value));
+    }
+
+    /// @brief Key로 항목 제거 (축출 콜백은 호출하지 않음)
+    /// @param key 제거할 키
+    /// @return 제거 성공 시 true, 키가 없으면 false
+    bool8 Remove(const K& key)
+    {
+        const uint64* found = m_indices.Find(key);
+        if (found == nullptr)
+        {
+            return false;
+        }
+
+        const uint64 index = *found;
+        m_indices.Remove(key);
+        Unlink(index);
+        m_totalCost -= m_nodes[index].cost;
+        m_nodes.RemoveAt(index);
+        return true;
+    }
+
+    /// @brief 모든 항목 제거 (축출 콜백은 호출하지 않음)
+    void Clear()
+    {
+        m_nodes.Clear();
+        m_indices.Clear();
+        m_totalCost = 0;
+        m_head = INVALID_INDEX;
+        m_tail = INVALID_INDEX;
+    }
+
+    /// @brief 비용 예산 변경 (줄어든 예산을 넘는 만큼 즉시 축출)
+    /// @param budget 새로운 비용 예산
+    void SetBudget(uint64 budget)
+    {
+        m_budget = budget;
+        EvictOverBudget(INVALID_INDEX);
+    }
+
+    /// @brief 가장 오래 사용하지 않은 항목 하나를 축출 (축출 콜백 호출)
+    /// @return 축출했으면 true, 비어있으면 false
+    bool8 EvictOldest()
+    {
+        if (m_tail == INVALID_INDEX)
+        {
+            return false;
+        }
+
+        Evict(m_tail);
+        return true;
+    }
+
+    /// @brief 비용 예산 반환
+    /// @return 비용 예산
+    uint64 GetBudget() const
+    {
+        return m_budget;
+    }
+
+    /// @brief 현재 저장된 항목 비용의 합 반환
+    /// @return 비용 합
+    uint64 GetTotalCost() const
+    {
+        return m_totalCost;
+    }
+
+    /// @brief 항목 개수 반환
+    /// @return 항목 개수
+    uint64 GetSize() const
+    {
+        return m_nodes.GetSize();
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_nodes.IsEmpty();
+    }
+
+private:
+    static constexpr uint64 INVALID_INDEX = UINT64_MAX;
+
+    struct Node
+    {
+        template<typename Value>
+        Node(const K& inKey, Value&& inValue)
+            : key(inKey)
+            , value(std::forward<Value>(inValue))
+            , cost(0)
+            , prev(INVALID_INDEX)
+            , next(INVALID_INDEX)
+        {
+        }
+
+        K key;
+        V value;
+        uint64 cost;
+        uint64 prev;
+        uint64 next;
+    };
+
+    template<typename Value>
+    V& PutImpl(const K& key, Value&& value)
+    {
+        uint64 index;
+        const uint64* found = m_indices.Find(key);
+        if (found != nullptr)
+        {
+            index = *found;
+            Node& node = m_nodes[index];
+            node.value = std::forward<Value>(value);
+            m_totalCost -= node.cost;
+            MoveToFront(index);
+        }
+        else
+        {
+            index = m_nodes.Emplace(key, std::forward<Value>(value));
+            m_indices.Insert(key, index);
+            PushFront(index);
+        }
+
+        Node& node = m_nodes[index];
+        node.cost = m_costOf(node.key, static_cast<const V&>(node.value));
+        m_totalCost += node.cost;
+
+        EvictOverBudget(index);
+        return node.value;
+    }
+
+    /// @brief 예산 안에 들어올 때까지 가장 오래된 항목부터 축출 (keep은 축출하지 않음)
+    void EvictOverBudget(uint64 keep)
+    {
+        while (m_totalCost > m_budget && m_tail != INVALID_INDEX && m_tail != keep)
+        {
+            Evict(m_tail);
+        }
+    }
+
+    void Evict(uint64 index)
+    {
+        Node& node = m_nodes[index];
+        Unlink(index);
+        m_totalCost -= node.cost;
+        m_indices.Remove(node.key);
+        m_onEvict(static_cast<const K&>(node.key), node.value);
+        m_nodes.RemoveAt(index);
+    }
+
+    void PushFront(uint64 index)
+    {
+        Node& node = m_nodes[index];
+        node.prev = INVALID_INDEX;
+        node.next = m_head;
+        if (m_head != INVALID_INDEX)
+        {
+            m_nodes[m_head].prev = index;
+        }
+        else
+        {
+            m_tail = index;
+        }
+        m_head = index;
+    }
+
+    void Unlink(uint64 index)
+    {
+        Node& node = m_nodes[index];
+        if (node.prev != INVALID_INDEX)
+        {
+            m_nodes[node.prev].next = node.next;
+        }
+        else
+        {
+            m_head = node.next;
+        }
+
+        if (node.next != INVALID_INDEX)
+        {
+            m_nodes[node.next].prev = node.prev;
+        }
+        else
+        {
+            m_tail = node.prev;
+        }
+    }
+
+    void MoveToFront(uint64 index)
+    {
+        if (m_head != index)
+        {
+            Unlink(index);
+            PushFront(index);
+        }
+    }
+
+    StableArray<Node, 64, Alloc> m_nodes;
+    HashMap<K, uint64, Hasher, Alloc> m_indices;
+    CostOf m_costOf;
+    OnEvict m_onEvict;
+    uint64 m_budget;
+    uint64 m_totalCost;
+    uint64 m_head;      // 가장 최근 사용
+    uint64 m_tail;      // 가장 오래 사용하지 않음
+};
+
+} // namespace Excep
@@ -0,0 +1,277 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include "Memory/Allocator.h"
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 고정 용량의 다중 생산자/다중 소비자 큐 (lock-free)
+/// @tparam T 저장할 요소의 타입
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note Dmitry Vyukov의 bounded MPMC 큐 구조입니다. 각 셀은 시퀀스 번호를 가지며,
+///       생산자/소비자는 위치 카운터를 CAS 한 번으로 예약한 뒤 셀의 시퀀스로 완료를 알립니다.
+///       뮤텍스를 사용하지 않으며 가득 차거나 비어 있으면 즉시 실패를 반환합니다.
+///       FIFO 순서는 위치 예약 순서 기준입니다.
+template<typename T, typename Alloc = DefaultAllocator>
+class MpmcQueue : private Alloc
+{
+private:
+    // 예약한 셀은 반드시 채워야 하므로, 미리 만든 요소를 셀로 옮기는 이동은 예외를 던지면 안 됨
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "MpmcQueue element type must be nothrow move constructible");
+
+    struct Cell
+    {
+        std::atomic<uint64> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T* GetValue()
+        {
+            return reinterpret_cast<T*>(&storage);
+        }
+    };
+
+public:
+    /// @brief 용량을 지정하여 생성
+    /// @param capacity 최소 용량 (2의 거듭제곱으로 올림)
+    /// @param allocator 사용할 할당자
+    explicit MpmcQueue(uint64 capacity, const Alloc& allocator = Alloc())
+        : Alloc(allocator)
+        , m_capacity(NextPowerOfTwo(capacity < 2 ? 2 : capacity))
+        , m_mask(m_capacity - 1)
+        , m_enqueuePos(0)
+        , m_dequeuePos(0)
+    {
+        m_cells = static_cast<Cell*>(Alloc::Allocate(m_capacity * sizeof(Cell), alignof(Cell)));
+        for (uint64 i = 0; i < m_capacity; ++i)
+        {
+            new (&m_cells[i].sequence) std::atomic<uint64>(i);
+        }
+    }
+
+    ~MpmcQueue()
+    {
+        // 소멸 시점에는 다른 스레드가 접근하지 않으므로 남은 요소를 순서대로 파괴
+        const uint64 enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (uint64 pos = m_dequeuePos.load(std::memory_order_relaxed); pos != enqueuePos; ++pos)
+        {
+            m_cells[pos & m_mask].GetValue()->~T();
+        }
+        Alloc::Deallocate(m_cells, m_capacity * sizeof(Cell), alignof(Cell));
+    }
+
+    // 여러 스레드가 공유하는 위치를 가지므로 복사/이동 불가
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+    MpmcQueue(MpmcQueue&&) = delete;
+    MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+    /// @brief 요소 추가
+    /// @param value 추가할 요소
+    /// @return 성공 시 true, 가득 차 있으면 false
+    bool8 TryPush(const T& value)
+    {
+        return TryEmplace(value);
+    }
+
+    /// @brief 요소 추가 (move semantics)
+    /// @param value 추가할 요소
+    /// @return 성공 시 true, 가득 차 있으면 false
+    bool8 TryPush(T&& value)
+    {
+        return TryEmplace(std::move(value));
+    }
+
+    /// @brief 요소를 제자리 생성하여 추가
+    /// @param args 요소 생성자 인자
+    /// @return 성공 시 true, 가득 차 있으면 false
+    /// @note 생성자가 예외를 던질 수 있으면 셀을 예약하기 전에 요소를 먼저 만든 뒤 셀로 이동합니다
+    ///       (예약한 셀을 채우지 못하면 소비자와 다음 바퀴의 생산자가 그 셀에서 영원히 멈추기 때문).
+    ///       이 경우 가득 차 있으면 만든 요소는 버려지며, 생성자의 예외는 큐를 바꾸지 않고 전달됩니다.
+    template<typename... Args>
+    bool8 TryEmplace(Args&&... args)
+    {
+        return TryEmplaceImpl(std::is_nothrow_constructible<T, Args&&...>(), std::forward<Args>(args)...);
+    }
+
+    /// @brief 여러 요소를 차례로 추가
+    /// @param values 추가할 요소 배열
+    /// @param count 요소 개수
+    /// @return 실제로 추가한 개수 (가득 차면 앞에서부터 들어간 만큼)
+    /// @note 요소마다 위치를 예약하므로 다른 생산자의 요소와 섞일 수 있습니다
+    uint64 TryPushBatch(const T* values, uint64 count)
+    {
+        uint64 pushCount = 0;
+        while (pushCount < count && TryEmplace(values[pushCount]))
+        {
+            ++pushCount;
+        }
+        return pushCount;
+    }
+
+    /// @brief 요소 꺼내기
+    /// @param outValue 꺼낸 요소를 받을 변수
+    /// @return 성공 시 true, 비어 있으면 false
+    bool8 TryPop(T& outValue)
+    {
+        uint64 pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &m_cells[pos & m_mask];
+            const uint64 sequence = cell->sequence.load(std::memory_order_acquire);
+            const int64 diff = static_cast<int64>(sequence - (pos + 1));
+            if (diff == 0)
+            {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 생산자가 아직 이 셀을 채우지 않음 (비어 있음)
+                return false;
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* value = cell->GetValue();
+        outValue = std::move(*value);
+        value->~T();
+
+        // 다음 바퀴의 생산자가 사용할 수 있도록 시퀀스를 한 바퀴 앞으로
+        cell->sequence.store(pos + m_capacity, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief 여러 요소를 차례로 꺼내기
+    /// @param outValues 꺼낸 요소를 받을 배열
+    /// @param maxCount 꺼낼 최대 개수
+    /// @return 실제로 꺼낸 개수
+    uint64 TryPopBatch(T* outValues, uint64 maxCount)
+    {
+        uint64 popCount = 0;
+        while (popCount < maxCount && TryPop(outValues[popCount]))
+        {
+            ++popCount;
+        }
+        return popCount;
+    }
+
+    /// @brief 현재 요소 개수의 근사값 반환
+    /// @return 요소 개수 (다른 스레드가 동시에 수정 중이면 호출 직후 달라질 수 있음)
+    uint64 GetSize() const
+    {
+        const uint64 dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+        const uint64 enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+        return (enqueuePos > dequeuePos) ? enqueuePos - dequeuePos : 0;
+    }
+
+    /// @brief 비어있는지 확인 (근사값)
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+    /// @brief 최대 용량 반환
+    /// @return 최대 요소 개수
+    uint64 GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return *this;
+    }
+
+private:
+    /// @brief 생산자 위치 하나를 예약하고 그 셀을 반환
+    /// @param outPos 예약한 위치
+    /// @return 예약한 셀 (가득 차 있으면 nullptr)
+    Cell* ReserveCell(uint64& outPos)
+    {
+        uint64 pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &m_cells[pos & m_mask];
+            const uint64 sequence = cell->sequence.load(std::memory_order_acquire);
+            const int64 diff = static_cast<int64>(sequence - pos);
+            if (diff == 0)
+            {
+                // 셀이 비어 있으므로 위치 예약 시도 (실패 시 pos는 최신 값으로 갱신됨)
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 한 바퀴 전의 요소가 아직 소비되지 않음 (가득 참)
+                return nullptr;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        outPos = pos;
+        return cell;
+    }
+
+    /// @brief 생성자가 예외를 던지지 않으면 예약한 셀에 바로 생성
+    template<typename... Args>
+    bool8 TryEmplaceImpl(std::true_type, Args&&... args)
+    {
+        uint64 pos;
+        Cell* cell = ReserveCell(pos);
+        if (cell == nullptr)
+        {
+            return false;
+        }
+
+        new (cell->GetValue()) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief 생성자가 예외를 던질 수 있으면 먼저 만들어 두고 예약한 셀로 이동 (이동은 예외 없음)
+    template<typename... Args>
+    bool8 TryEmplaceImpl(std::false_type, Args&&... args)
+    {
+        T value(std::forward<Args>(args)...);
+        return TryEmplaceImpl(std::true_type(), std::move(value));
+    }
+
+    // 멤버 사이에 캐시 라인 크기의 패딩 배열을 넣어 서로 다른 캐시 라인에 오도록 분리
+    // (alignas를 쓰면 큐 자체가 64바이트 정렬 타입이 되어, 큐를 담는 할당자/컨테이너마다 그 정렬을 보장해야 함)
+    // 읽기 전용 (모든 스레드 공유)
+    Cell* m_cells;
+    const uint64 m_capacity;
+    const uint64 m_mask;
+    char8 m_padding0[CACHE_LINE_SIZE];
+
+    // 생산자끼리 경쟁하는 캐시 라인
+    std::atomic<uint64> m_enqueuePos;
+    char8 m_padding1[CACHE_LINE_SIZE];
+
+    // 소비자끼리 경쟁하는 캐시 라인
+    std::atomic<uint64> m_dequeuePos;
+    char8 m_padding2[CACHE_LINE_SIZE];
+};
+
+} // namespace Excep
@@ -0,0 +1,299 @@
+﻿#include "Core/Pch.h"
+#include "Container/Name.h"
+#include "Core/Intrinsics.h"
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+namespace Excep
+{
+
+namespace
+{
+
+/// @brief 등록된 문자열 하나의 정보
+struct NameEntry
+{
+    const char8* str;
+    uint64 length;
+    uint64 hash;
+};
+
+/// @brief 전역 이름 테이블
+/// @note 조회는 잠금 없이 해시 슬롯 배열을 읽고, 등록만 뮤텍스로 직렬화합니다.
+///       엔트리와 문자열은 고정 주소의 청크/아레나에 저장되어 한 번 공개된 뒤에는 이동하지 않으며,
+///       슬롯 배열이 커질 때 이전 배열은 읽는 중인 스레드를 위해 종료 시까지 보관합니다.
+class NameTable
+{
+public:
+    NameTable()
+        : m_slots(nullptr)
+        , m_entryCount(0)
+        , m_poolCursor(nullptr)
+        , m_poolEnd(nullptr)
+    {
+        for (uint64 i = 0; i < MAX_CHUNK_COUNT; ++i)
+        {
+            m_chunks[i] = nullptr;
+        }
+
+        // 인덱스 0은 빈 이름으로 예약
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_slots.store(CreateSlotArray(INITIAL_SLOT_COUNT), std::memory_order_relaxed);
+        AddEntry("", 0, HashBytes("", 0));
+    }
+
+    ~NameTable()
+    {
+        for (uint64 i = 0; i < m_retiredSlots.GetSize(); ++i)
+        {
+            FreeSlotArray(m_retiredSlots[i]);
+        }
+        FreeSlotArray(m_slots.load(std::memory_order_relaxed));
+
+        for (uint64 i = 0; i < MAX_CHUNK_COUNT; ++i)
+        {
+            if (m_chunks[i] != nullptr)
+            {
+                DefaultAllocator().Deallocate(m_chunks[i], CHUNK_SIZE * sizeof(NameEntry), alignof(NameEntry));
+            }
+        }
+        for (uint64 i = 0; i < m_poolBlocks.GetSize(); ++i)
+        {
+            DefaultAllocator().Deallocate(m_poolBlocks[i].data, m_poolBlocks[i].size, 1);
+        }
+    }
+
+    /// @brief 이미 등록된 문자열의 인덱스 찾기 (잠금 없음)
+    /// @return 인덱스 (없으면 0)
+    uint32 Find(const char8* str, uint64 length, uint64 hash) const
+    {
+        const SlotArray* slots = m_slots.load(std::memory_order_acquire);
+        return FindInSlots(slots, str, length, hash);
+    }
+
+    /// @brief 문자열을 등록하고 인덱스 반환 (이미 있으면 기존 인덱스)
+    uint32 Intern(const char8* str, uint64 length, uint64 hash)
+    {
+        uint32 index = Find(str, length, hash);
+        if (index != 0 || length == 0)
+        {
+            return index;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // 잠금을 기다리는 동안 다른 스레드가 등록했을 수 있음
+        index = FindInSlots(m_slots.load(std::memory_order_relaxed), str, length, hash);
+        if (index != 0)
+        {
+            return index;
+        }
+        return AddEntry(str, length, hash);
+    }
+
+    /// @brief 인덱스로 엔트리 접근
+    const NameEntry& GetEntry(uint32 index) const
+    {
+        return m_chunks[index >> CHUNK_SHIFT][index & (CHUNK_SIZE - 1)];
+    }
+
+private:
+    static constexpr uint64 CHUNK_SHIFT = 12;
+    static constexpr uint64 CHUNK_SIZE = 1ull << CHUNK_SHIFT;
+    static constexpr uint64 MAX_CHUNK_COUNT = 1024;
+    static constexpr uint64 INITIAL_SLOT_COUNT = 1024;
+    static constexpr uint64 POOL_BLOCK_SIZE = 64 * 1024;
+
+    /// @brief 인덱스를 담는 Open Addressing 슬롯 배열 (0은 빈 슬롯, 헤더 바로 뒤에 배열이 이어짐)
+    struct SlotArray
+    {
+        uint64 mask;
+        std::atomic<uint32>* indices;
+    };
+
+    /// @brief 아레나 블록
+    struct PoolBlock
+    {
+        char8* data;
+        uint64 size;
+    };
+
+    static uint64 SlotArrayBytes(uint64 count)
+    {
+        return sizeof(SlotArray) + count * sizeof(std::atomic<uint32>);
+    }
+
+    static SlotArray* CreateSlotArray(uint64 count)
+    {
+        void* memory = DefaultAllocator().Allocate(SlotArrayBytes(count), alignof(SlotArray));
+        SlotArray* slots = static_cast<SlotArray*>(memory);
+        slots->mask = count - 1;
+        slots->indices = reinterpret_cast<std::atomic<uint32>*>(slots + 1);
+        for (uint64 i = 0; i < count; ++i)
+        {
+            new (&slots->indices[i]) std::atomic<uint32>(0);
+        }
+        return slots;
+    }
+
+    static void FreeSlotArray(SlotArray* slots)
+    {
+        DefaultAllocator().Deallocate(slots, SlotArrayBytes(slots->mask + 1), alignof(SlotArray));
+    }
+
+    uint32 FindInSlots(const SlotArray* slots, const char8* str, uint64 length, uint64 hash) const
+    {
+        for (uint64 slot = MixHash(hash) & slots->mask; ; slot = (slot + 1) & slots->mask)
+        {
+            // acquire: 인덱스가 보이면 그 엔트리와 문자열의 내용도 보임
+            uint32 index = slots->indices[slot].load(std::memory_order_acquire);
+            if (index == 0)
+            {
+                return 0;
+            }
+
+            const NameEntry& entry = GetEntry(index);
+            if (entry.hash == hash && entry.length == length && std::memcmp(entry.str, str, length) == 0)
+            {
+                return index;
+            }
+        }
+    }
+
+    /// @brief 새 엔트리를 추가하고 슬롯에 공개 (m_mutex 보유 상태에서 호출)
+    uint32 AddEntry(const char8* str, uint64 length, uint64 hash)
+    {
+        const uint64 index = m_entryCount;
+        const uint64 chunk = index >> CHUNK_SHIFT;
+        if (chunk >= MAX_CHUNK_COUNT)
+        {
+            throw std::length_error("Name table is full");
+        }
+        if (m_chunks[chunk] == nullptr)
+        {
+            void* memory = DefaultAllocator().Allocate(CHUNK_SIZE * sizeof(NameEntry), alignof(NameEntry));
+            m_chunks[chunk] = static_cast<NameEntry*>(memory);
+        }
+
+        NameEntry& entry = m_chunks[chunk][index & (CHUNK_SIZE - 1)];
+        entry.str = CopyToPool(str, length);
+        entry.length = length;
+        entry.hash = hash;
+        ++m_entryCount;
+
+        // 빈 이름은 조회 대상이 아니므로 슬롯에 넣지 않음
+        if (index == 0)
+        {
+            return 0;
+        }
+
+        // 부하율 50%를 넘으면 2배 크기의 슬롯 배열로 옮긴 뒤 교체
+        SlotArray* slots = m_slots.load(std::memory_order_relaxed);
+        if ((m_entryCount - 1) * 2 > slots->mask + 1)
+        {
+            SlotArray* grown = CreateSlotArray((slots->mask + 1) * 2);
+            for (uint64 i = 1; i < index; ++i)
+            {
+                InsertSlot(grown, static_cast<uint32>(i));
+            }
+            m_slots.store(grown, std::memory_order_release);
+            m_retiredSlots.Add(slots);
+            slots = grown;
+        }
+
+        InsertSlot(slots, static_cast<uint32>(index));
+        return static_cast<uint32>(index);
+    }
+
+    void InsertSlot(SlotArray* slots, uint32 index)
+    {
+        for (uint64 slot = MixHash(GetEntry(index).hash) & slots->mask; ; slot = (slot + 1) & slots->mask)
+        {
+            if (slots->indices[slot].load(std::memory_order_relaxed) == 0)
+            {
+                slots->indices[slot].store(index, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    /// @brief 문자열을 아레나 블록에 null 종료로 복사
+    const char8* CopyToPool(const char8* str, uint64 length)
+    {
+        const uint64 required = length + 1;
+        if (m_poolCursor == nullptr || static_cast<uint64>(m_poolEnd - m_poolCursor) < required)
+        {
+            const uint64 blockSize = (required > POOL_BLOCK_SIZE) ? required : POOL_BLOCK_SIZE;
+            char8* block = static_cast<char8*>(DefaultAllocator().Allocate(blockSize, 1));
+            m_poolBlocks.Add(PoolBlock{block, blockSize});
+            m_poolCursor = block;
+            m_poolEnd = block + blockSize;
+        }
+
+        char8* result = m_poolCursor;
+        std::memcpy(result, str, length);
+        result[length] = '\0';
+        m_poolCursor += required;
+        return result;
+    }
+
+    std::atomic<SlotArray*> m_slots;
+    NameEntry* m_chunks[MAX_CHUNK_COUNT];
+    uint64 m_entryCount;
+
+    char8* m_poolCursor;
+    char8* m_poolEnd;
+    DynamicArray<PoolBlock> m_poolBlocks;
+    DynamicArray<SlotArray*> m_retiredSlots;
+
+    std::mutex m_mutex;
+};
+
+NameTable& GetNameTable()
+{
+    static NameTable table;
+    return table;
+}
+
+} // namespace
+
+Name::Name(const char8* str)
+    : Name(str, static_cast<uint64>(std::strlen(str)))
+{
+}
+
+Name::Name(const char8* str, uint64 length)
+    : m_index(GetNameTable().Intern(str, length, HashBytes(str, length)))
+{
+}
+
+Name::Name(StringView8 str)
+    : Name(str.GetData(), str.GetLength())
+{
+}
+
+Name Name::Find(StringView8 str)
+{
+    Name name;
+    name.m_index = GetNameTable().Find(str.GetData(), str.GetLength(), HashBytes(str.GetData(), str.GetLength()));
+    return name;
+}
+
+uint64 Name::GetHash() const
+{
+    return GetNameTable().GetEntry(m_index).hash;
+}
+
+const char8* Name::GetCString() const
+{
+    return GetNameTable().GetEntry(m_index).str;
+}
+
+uint64 Name::GetLength() const
+{
+    return GetNameTable().GetEntry(m_index).length;
+}
+
+} // namespace Excep
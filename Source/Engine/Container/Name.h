@@ -0,0 +1,93 @@
+﻿#pragma once
+#include "Core/ExcepAPI.h"
+#include "Container/Hash.h"
+#include "Container/String8.h"
+
+namespace Excep
+{
+
+/// @brief 전역 이름 테이블에 등록(intern)된 문자열 식별자
+/// @note 같은 문자열은 항상 같은 32비트 인덱스를 가지므로 비교는 정수 비교 한 번이고,
+///       해시 컨테이너에서는 인덱스 하나만 해시합니다. 이미 등록된 문자열의 조회는 잠금 없이 수행되며,
+///       등록된 문자열은 프로그램 종료 시까지 해제되지 않습니다. 대소문자를 구분합니다.
+class EXCEP_API Name
+{
+public:
+    /// @brief 빈 이름 (인덱스 0)
+    Name()
+        : m_index(0)
+    {
+    }
+
+    /// @brief C 스타일 문자열로 이름 생성 (처음 보는 문자열이면 테이블에 등록)
+    /// @param str C 스타일 문자열
+    explicit Name(const char8* str);
+
+    /// @brief 길이를 지정한 문자열로 이름 생성 (처음 보는 문자열이면 테이블에 등록)
+    /// @param str 문자열 시작 포인터 (null 종료가 아니어도 됨)
+    /// @param length 문자열 길이
+    Name(const char8* str, uint64 length);
+
+    /// @brief 문자열 뷰로 이름 생성 (처음 보는 문자열이면 테이블에 등록)
+    /// @param str 문자열 뷰 (String8도 그대로 전달 가능)
+    explicit Name(StringView8 str);
+
+    /// @brief 등록하지 않고 이미 등록된 이름만 찾기
+    /// @param str 찾을 문자열
+    /// @return 등록된 이름 (없으면 빈 이름)
+    static Name Find(StringView8 str);
+
+    /// @brief 이름 테이블의 인덱스 반환
+    /// @return 인덱스 (빈 이름은 0)
+    uint32 GetIndex() const
+    {
+        return m_index;
+    }
+
+    /// @brief 빈 이름인지 확인
+    /// @return 빈 이름이면 true
+    bool8 IsNone() const
+    {
+        return m_index == 0;
+    }
+
+    /// @brief 등록 시 계산해 둔 문자열 해시 반환
+    /// @return 문자열 내용의 해시 값
+    uint64 GetHash() const;
+
+    /// @brief 문자열 반환
+    /// @return null 종료 문자열 (프로그램 종료 시까지 유효)
+    const char8* GetCString() const;
+
+    /// @brief 문자열 길이 반환
+    /// @return 문자 개수
+    uint64 GetLength() const;
+
+    /// @brief String8로 변환
+    /// @return 문자열 복사본 (등록된 길이만큼 복사하므로 중간의 '\0'도 유지)
+    String8 ToString() const
+    {
+        return String8(StringView8(GetCString(), GetLength()));
+    }
+
+    bool8 operator==(const Name& other) const { return m_index == other.m_index; }
+    bool8 operator!=(const Name& other) const { return m_index != other.m_index; }
+
+    /// @brief 정렬 컨테이너용 비교 (문자열 순서가 아닌 등록 순서)
+    bool8 operator<(const Name& other) const { return m_index < other.m_index; }
+
+private:
+    uint32 m_index;
+};
+
+/// @brief Name은 등록 인덱스가 곧 고유 식별자이므로 인덱스만 해시
+template<>
+struct Hash<Name>
+{
+    uint64 operator()(const Name& name) const
+    {
+        return name.GetIndex();
+    }
+};
+
+} // namespace Excep
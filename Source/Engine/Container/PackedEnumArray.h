@@ -0,0 +1,362 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include "Container/BitVector.h"
+#include "Container/DynamicArray.h"
+#include "Memory/Allocator.h"
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Excep
+{
+
+/// @brief 열거형(또는 작은 정수) 값을 요소당 Bits 비트로 64비트 워드에 채워 저장하는 배열 컨테이너
+/// @tparam E 요소 타입 (enum class 또는 정수, 값은 0 ~ 2^Bits - 1)
+/// @tparam Bits 요소 하나의 비트 수 (1 ~ 8)
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 요소는 워드 경계를 넘지 않도록 워드마다 64 / Bits개씩 배치합니다.
+///       CountOf/ForEachOf/FindAll/CompareEqual은 요소를 하나씩 꺼내지 않고 워드 단위 SWAR 비교로
+///       한 번에 64 / Bits개를 비교합니다 (2비트면 32개, 8비트면 8개).
+///       오브젝트 100만 개의 메시 타입(2비트)이 256KB에 들어가므로 상태 전체가 L2 캐시에 머무를 수 있습니다.
+template<typename E, uint64 Bits, typename Alloc = DefaultAllocator>
+class PackedEnumArray
+{
+public:
+    static_assert(Bits >= 1 && Bits <= 8, "PackedEnumArray Bits must be between 1 and 8");
+
+    /// @brief 요소 하나의 비트 수
+    static constexpr uint64 BITS_PER_ELEMENT = Bits;
+
+    /// @brief 워드 하나에 담는 요소 개수
+    static constexpr uint64 ELEMENTS_PER_WORD = 64 / Bits;
+
+    /// @brief 기본 생성자 (빈 배열)
+    PackedEnumArray()
+        : m_size(0)
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성 (빈 배열)
+    /// @param allocator 사용할 할당자
+    explicit PackedEnumArray(const Alloc& allocator)
+        : m_words(allocator)
+        , m_size(0)
+    {
+    }
+
+    /// @brief 크기와 초기값을 지정하여 생성
+    /// @param size 요소 개수
+    /// @param value 모든 요소의 초기값
+    explicit PackedEnumArray(uint64 size, E value = E())
+        : m_size(0)
+    {
+        Resize(size, value);
+    }
+
+    /// @brief 끝에 요소 추가
+    /// @param value 추가할 값
+    void Add(E value)
+    {
+        if (m_size % ELEMENTS_PER_WORD == 0)
+        {
+            m_words.Add(0);
+        }
+        ++m_size;
+        Set(m_size - 1, value);
+    }
+
+    /// @brief 요소 값 변경 (경계 검사 없음)
+    /// @param index 요소의 인덱스
+    /// @param value 새 값
+    void Set(uint64 index, E value)
+    {
+        const uint64 bits = ToBits(value);
+        const uint64 shift = (index % ELEMENTS_PER_WORD) * Bits;
+        uint64& word = m_words[index / ELEMENTS_PER_WORD];
+        word = (word & ~(ELEMENT_MASK << shift)) | (bits << shift);
+    }
+
+    /// @brief 요소 값 반환 (경계 검사 없음)
+    /// @param index 요소의 인덱스
+    /// @return 요소 값
+    E Get(uint64 index) const
+    {
+        const uint64 shift = (index % ELEMENTS_PER_WORD) * Bits;
+        return static_cast<E>((m_words[index / ELEMENTS_PER_WORD] >> shift) & ELEMENT_MASK);
+    }
+
+    /// @brief 요소 값 반환 (경계 검사 없음)
+    /// @param index 요소의 인덱스
+    /// @return 요소 값
+    E operator[](uint64 index) const
+    {
+        return Get(index);
+    }
+
+    /// @brief 요소 값 반환 (경계 검사 수행)
+    /// @param index 요소의 인덱스
+    /// @return 요소 값
+    E GetAt(uint64 index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("PackedEnumArray::GetAt - index out of range");
+        }
+        return Get(index);
+    }
+
+    /// @brief 요소 개수 변경
+    /// @param size 새 요소 개수
+    /// @param value 늘어난 요소의 초기값
+    void Resize(uint64 size, E value = E())
+    {
+        const uint64 oldSize = m_size;
+        m_words.Resize((size + ELEMENTS_PER_WORD - 1) / ELEMENTS_PER_WORD, Broadcast(ToBits(value)));
+        m_size = size;
+
+        // 기존 마지막 워드의 남는 칸과 줄어든 뒤 남는 칸을 정리
+        for (uint64 i = oldSize; i < size && i % ELEMENTS_PER_WORD != 0; ++i)
+        {
+            Set(i, value);
+        }
+        ClearUnusedLanes();
+    }
+
+    /// @brief 모든 요소를 같은 값으로 채움
+    /// @param value 채울 값
+    void Fill(E value)
+    {
+        const uint64 pattern = Broadcast(ToBits(value));
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            m_words[i] = pattern;
+        }
+        ClearUnusedLanes();
+    }
+
+    /// @brief 모든 요소 제거
+    void Clear()
+    {
+        m_words.Clear();
+        m_size = 0;
+    }
+
+    /// @brief 용량 예약
+    /// @param capacity 예약할 요소 개수
+    void Reserve(uint64 capacity)
+    {
+        m_words.Reserve((capacity + ELEMENTS_PER_WORD - 1) / ELEMENTS_PER_WORD);
+    }
+
+    /// @brief value와 같은 요소 개수 반환
+    /// @param value 셀 값
+    /// @return 같은 요소 개수
+    uint64 CountOf(E value) const
+    {
+        const uint64 pattern = Broadcast(ToBits(value));
+        uint64 count = 0;
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            count += CountSetBits64(MatchLanes(m_words[i], pattern, GetLaneMask(i)));
+        }
+        return count;
+    }
+
+    /// @brief value와 같은 모든 요소의 인덱스를 오름차순으로 순회
+    /// @param value 찾을 값
+    /// @param func uint64 인덱스를 받는 함수 객체
+    template<typename Func>
+    void ForEachOf(E value, Func&& func) const
+    {
+        const uint64 pattern = Broadcast(ToBits(value));
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            uint64 matches = MatchLanes(m_words[i], pattern, GetLaneMask(i));
+            while (matches != 0)
+            {
+                // 일치한 칸은 최상위 비트만 켜져 있음
+                func(i * ELEMENTS_PER_WORD + CountTrailingZeros64(matches) / Bits);
+                matches &= matches - 1;
+            }
+        }
+    }
+
+    /// @brief value와 같은 모든 요소의 인덱스를 배열 끝에 추가
+    /// @param value 찾을 값
+    /// @param outIndices 인덱스를 받을 배열 (기존 요소는 유지)
+    template<typename IndexAlloc>
+    void FindAll(E value, DynamicArray<uint64, IndexAlloc>& outIndices) const
+    {
+        ForEachOf(value, [&outIndices](uint64 index) { outIndices.Add(index); });
+    }
+
+    /// @brief 요소마다 value와 같은지를 비트 하나로 기록
+    /// @param value 비교할 값
+    /// @param outMask 결과 비트 배열 (크기가 GetSize()로 바뀌며, i번째 비트는 요소 i가 value이면 1)
+    /// @note 워드마다 비교 결과를 64 / Bits개의 연속 비트로 압축하여 결과 배열에 워드 단위로 기록합니다
+    template<typename MaskAlloc>
+    void CompareEqual(E value, BitVector<MaskAlloc>& outMask) const
+    {
+        outMask.Resize(m_size);
+        uint64* outWords = outMask.GetWords();
+        const uint64 outWordCount = outMask.GetWordCount();
+        const uint64 pattern = Broadcast(ToBits(value));
+
+        // 워드마다 ELEMENTS_PER_WORD 비트씩 이어 붙이고, 64비트가 차면 기록
+        uint64 pending = 0;
+        uint64 pendingBits = 0;
+        uint64 outIndex = 0;
+        for (uint64 i = 0; i < m_words.GetSize(); ++i)
+        {
+            const uint64 bits = CompressLanes(MatchLanes(m_words[i], pattern, GetLaneMask(i)), CompressTag());
+            pending |= bits << pendingBits;
+            pendingBits += ELEMENTS_PER_WORD;
+            if (pendingBits >= 64)
+            {
+                outWords[outIndex++] = pending;
+                pendingBits -= 64;
+
+                // 이번 워드에서 64비트를 넘쳐 기록하지 못한 상위 비트를 다음 워드로 넘김
+                pending = (pendingBits != 0) ? (bits >> (ELEMENTS_PER_WORD - pendingBits)) : 0;
+            }
+        }
+
+        // 남은 비트 (마지막 워드의 m_size 이후 칸은 0이므로 결과 배열 밖의 비트는 항상 0)
+        if (outIndex < outWordCount)
+        {
+            outWords[outIndex] = pending;
+        }
+    }
+
+    /// @brief 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_size;
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// @brief 저장에 사용하는 워드 개수 반환
+    /// @return 64비트 워드 개수
+    uint64 GetWordCount() const
+    {
+        return m_words.GetSize();
+    }
+
+private:
+    static constexpr uint64 ELEMENT_MASK = (1ull << Bits) - 1;
+
+    /// @brief 워드에서 칸이 차지하는 비트가 모두 1인 패턴 (64 / Bits가 나누어떨어지지 않으면 상위 비트는 사용 안 함)
+    static constexpr uint64 USED_BITS = (ELEMENTS_PER_WORD * Bits == 64)
+        ? ~0ull
+        : ((1ull << (ELEMENTS_PER_WORD * Bits)) - 1);
+
+    /// @brief 모든 칸의 최하위 비트가 1인 패턴
+    static constexpr uint64 LANE_ONES = USED_BITS / ELEMENT_MASK;
+
+    /// @brief 모든 칸의 최상위 비트가 1인 패턴
+    static constexpr uint64 LANE_HIGH_BITS = LANE_ONES << (Bits - 1);
+
+    /// @brief 모든 칸의 최상위 비트를 제외한 나머지 비트가 1인 패턴
+    static constexpr uint64 LANE_LOW_BITS = LANE_ONES * (ELEMENT_MASK >> 1);
+
+    static uint64 ToBits(E value)
+    {
+        const uint64 bits = static_cast<uint64>(value);
+        assert(bits <= ELEMENT_MASK && "PackedEnumArray - value does not fit in Bits");
+        return bits;
+    }
+
+    static uint64 Broadcast(uint64 bits)
+    {
+        return bits * LANE_ONES;
+    }
+
+    /// @brief word의 칸 중 pattern과 같은 칸의 최상위 비트만 켠 값
+    /// @note 칸마다 차이 값의 하위 비트에 (2^(Bits-1) - 1)을 더하면 0이 아닌 칸만 최상위 비트로 올림이 생기며,
+    ///       더한 값이 칸 크기를 넘지 않으므로 이웃 칸으로 올림이 번지지 않습니다
+    static uint64 MatchLanes(uint64 word, uint64 pattern, uint64 laneMask)
+    {
+        const uint64 diff = word ^ pattern;
+        const uint64 nonZero = (((diff & LANE_LOW_BITS) + LANE_LOW_BITS) | diff) & LANE_HIGH_BITS;
+        return ~nonZero & LANE_HIGH_BITS & laneMask;
+    }
+
+    /// @brief 칸 비트 수가 2의 거듭제곱이면 칸이 워드를 꽉 채우므로 시프트/마스크 단계로 압축 가능
+    using CompressTag = std::integral_constant<bool8, (Bits & (Bits - 1)) == 0>;
+
+    /// @brief 압축 한 단계: 간격 Stride로 놓인 (Stride / Bits)비트 묶음 두 개를 간격 2 * Stride의 한 묶음으로 합침
+    /// @note 마스크는 컴파일 시간 상수이며, 간격이 64가 되면 끝납니다 (2비트: 간격 2 -> 4 -> ... -> 32, 5단계)
+    template<uint64 Stride, bool8 DONE = (Stride >= 64)>
+    struct LaneCompressor
+    {
+        static constexpr uint64 GROUP_BITS = Stride / Bits;
+        static constexpr uint64 GROUP_MASK = (GROUP_BITS * 2 == 64) ? ~0ull : ((1ull << (GROUP_BITS * 2)) - 1);
+        static constexpr uint64 MASK = (Stride * 2 >= 64)
+            ? GROUP_MASK
+            : GROUP_MASK * (~0ull / ((1ull << (Stride * 2)) - 1));
+
+        static uint64 Run(uint64 bits)
+        {
+            bits = (bits | (bits >> (Stride - GROUP_BITS))) & MASK;
+            return LaneCompressor<Stride * 2>::Run(bits);
+        }
+    };
+
+    template<uint64 Stride>
+    struct LaneCompressor<Stride, true>
+    {
+        static uint64 Run(uint64 bits)
+        {
+            return bits;
+        }
+    };
+
+    /// @brief MatchLanes 결과(칸마다 최상위 비트)를 칸 i가 비트 i인 연속 비트로 압축 (2의 거듭제곱 Bits)
+    /// @note Bits가 1이면 일치 결과가 이미 압축된 형태입니다
+    static uint64 CompressLanes(uint64 matches, std::true_type)
+    {
+        return LaneCompressor<(Bits == 1) ? 64 : Bits>::Run(matches >> (Bits - 1));
+    }
+
+    /// @brief MatchLanes 결과를 연속 비트로 압축 (칸이 워드를 꽉 채우지 않는 3, 5, 6, 7비트)
+    /// @note 일치한 칸만 순회하므로 비용은 일치 개수에 비례합니다
+    static uint64 CompressLanes(uint64 matches, std::false_type)
+    {
+        uint64 bits = 0;
+        while (matches != 0)
+        {
+            bits |= 1ull << (CountTrailingZeros64(matches) / Bits);
+            matches &= matches - 1;
+        }
+        return bits;
+    }
+
+    /// @brief 워드의 유효한 칸만 남기는 마스크 (마지막 워드는 m_size 이후 칸 제외)
+    uint64 GetLaneMask(uint64 wordIndex) const
+    {
+        const uint64 lanes = m_size - wordIndex * ELEMENTS_PER_WORD;
+        return (lanes >= ELEMENTS_PER_WORD) ? ~0ull : ((1ull << (lanes * Bits)) - 1);
+    }
+
+    /// @brief 마지막 워드에서 m_size 이후 칸을 0으로 정리
+    void ClearUnusedLanes()
+    {
+        if (!m_words.IsEmpty())
+        {
+            m_words.GetBack() &= GetLaneMask(m_words.GetSize() - 1);
+        }
+    }
+
+    DynamicArray<uint64, Alloc> m_words;
+    uint64 m_size;
+};
+
+} // namespace Excep
@@ -0,0 +1,386 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/DynamicArray.h"
+#include "Container/Hash.h"
+#include "Memory/Allocator.h"
+#include <stdexcept>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief SlotMap 요소를 가리키는 핸들 (32비트 인덱스 + 32비트 세대)
+/// @note 요소가 제거되면 슬롯의 세대가 바뀌므로 제거 전에 받은 핸들은 더 이상 아무것도 가리키지 않습니다.
+///       기본 생성된 핸들은 어떤 요소도 가리키지 않습니다. 세대는 32비트이므로
+///       한 슬롯이 약 20억 번 재사용되면 순환합니다.
+struct SlotHandle
+{
+    uint32 index;
+    uint32 generation;
+
+    /// @brief 기본 생성자 (Null 핸들)
+    SlotHandle()
+        : index(0)
+        , generation(0)
+    {
+    }
+
+    /// @brief 인덱스와 세대로 생성
+    /// @param inIndex 슬롯 인덱스
+    /// @param inGeneration 슬롯 세대
+    SlotHandle(uint32 inIndex, uint32 inGeneration)
+        : index(inIndex)
+        , generation(inGeneration)
+    {
+    }
+
+    /// @brief Null 핸들인지 확인
+    /// @return 한 번도 발급되지 않은 핸들이면 true
+    bool8 IsNull() const
+    {
+        return generation == 0;
+    }
+
+    bool8 operator==(const SlotHandle& other) const
+    {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool8 operator!=(const SlotHandle& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/// @brief SlotHandle 해시 (인덱스와 세대를 하나의 64비트 값으로 합침)
+template<>
+struct Hash<SlotHandle>
+{
+    uint64 operator()(const SlotHandle& handle) const
+    {
+        return (static_cast<uint64>(handle.generation) << 32) | handle.index;
+    }
+};
+
+/// @brief 세대 핸들로 접근하는 연속 메모리 컨테이너
+/// @tparam T 저장할 요소의 타입
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 요소는 빈틈 없는 하나의 배열에 저장되어 순회 시 건너뛰는 요소가 없습니다.
+///       삽입/제거/핸들 조회는 모두 O(1)이며, 제거된 슬롯은 free list로 재사용됩니다.
+///       제거 시 마지막 요소가 빈 자리로 이동하므로 요소의 주소와 순회 순서는 유지되지 않습니다.
+///       요소를 오래 참조할 때는 포인터 대신 핸들을 보관합니다.
+template<typename T, typename Alloc = DefaultAllocator>
+class SlotMap
+{
+private:
+    using StorageType = DynamicArray<T, Alloc>;
+
+    /// @brief 핸들 인덱스가 가리키는 간접 슬롯
+    /// @note 세대가 홀수면 사용 중이고 denseIndex가 요소 위치, 짝수면 비어 있고 nextFree가 다음 빈 슬롯입니다.
+    struct Slot
+    {
+        union
+        {
+            uint32 denseIndex;
+            uint32 nextFree;
+        };
+        uint32 generation;
+    };
+
+    static constexpr uint32 INVALID_INDEX = UINT32_MAX;
+
+public:
+    using Iterator = typename StorageType::Iterator;
+    using ConstIterator = typename StorageType::ConstIterator;
+
+    /// @brief 기본 생성자
+    SlotMap()
+        : m_freeHead(INVALID_INDEX)
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit SlotMap(const Alloc& allocator)
+        : m_values(allocator)
+        , m_denseToSlot(allocator)
+        , m_slots(allocator)
+        , m_freeHead(INVALID_INDEX)
+    {
+    }
+
+    /// @brief 요소 삽입
+    /// @param value 삽입할 요소
+    /// @return 삽입된 요소의 핸들
+    SlotHandle Insert(const T& value)
+    {
+        return Emplace(value);
+    }
+
+    /// @brief 요소 삽입 (move semantics)
+    /// @param value 삽입할 요소
+    /// @return 삽입된 요소의 핸들
+    SlotHandle Insert(T&& value)
+    {
+        return Emplace(std::move(value));
+    }
+
+    /// @brief 요소를 제자리 생성하여 삽입
+    /// @param args 요소 생성자 인자
+    /// @return 삽입된 요소의 핸들
+    template<typename... Args>
+    SlotHandle Emplace(Args&&... args)
+    {
+        const uint32 slotIndex = AcquireSlot();
+        const uint32 denseIndex = static_cast<uint32>(m_values.GetSize());
+
+        try
+        {
+            m_values.Emplace(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            ReleaseSlot(slotIndex);
+            throw;
+        }
+        m_denseToSlot.Add(slotIndex);
+
+        Slot& slot = m_slots[slotIndex];
+        slot.denseIndex = denseIndex;
+        ++slot.generation;
+        return SlotHandle(slotIndex, slot.generation);
+    }
+
+    /// @brief 핸들이 가리키는 요소 제거
+    /// @param handle 제거할 요소의 핸들
+    /// @return 제거 성공 시 true, 이미 제거되었거나 잘못된 핸들이면 false
+    /// @note 마지막 요소가 제거된 자리로 이동합니다
+    bool8 Remove(SlotHandle handle)
+    {
+        if (!Contains(handle))
+        {
+            return false;
+        }
+
+        Slot& slot = m_slots[handle.index];
+        const uint32 denseIndex = slot.denseIndex;
+        const uint32 lastIndex = static_cast<uint32>(m_values.GetSize() - 1);
+        if (denseIndex != lastIndex)
+        {
+            m_values[denseIndex] = std::move(m_values[lastIndex]);
+            m_denseToSlot[denseIndex] = m_denseToSlot[lastIndex];
+            m_slots[m_denseToSlot[denseIndex]].denseIndex = denseIndex;
+        }
+        m_values.Pop();
+        m_denseToSlot.Pop();
+
+        ++slot.generation;
+        ReleaseSlot(handle.index);
+        return true;
+    }
+
+    /// @brief 핸들이 살아있는 요소를 가리키는지 확인
+    /// @param handle 확인할 핸들
+    /// @return 유효하면 true, 제거되었거나 잘못된 핸들이면 false
+    bool8 Contains(SlotHandle handle) const
+    {
+        return handle.index < m_slots.GetSize()
+            && m_slots[handle.index].generation == handle.generation
+            && (handle.generation & 1) != 0;
+    }
+
+    /// @brief 핸들로 요소 찾기
+    /// @param handle 요소의 핸들
+    /// @return 요소의 포인터 (오래되었거나 잘못된 핸들이면 nullptr)
+    T* Find(SlotHandle handle)
+    {
+        return Contains(handle) ? &m_values[m_slots[handle.index].denseIndex] : nullptr;
+    }
+
+    /// @brief 핸들로 요소 찾기 (const 버전)
+    /// @param handle 요소의 핸들
+    /// @return 요소의 const 포인터 (오래되었거나 잘못된 핸들이면 nullptr)
+    const T* Find(SlotHandle handle) const
+    {
+        return Contains(handle) ? &m_values[m_slots[handle.index].denseIndex] : nullptr;
+    }
+
+    /// @brief 핸들로 요소 접근 (유효성 검사, 잘못된 핸들이면 예외)
+    /// @param handle 요소의 핸들
+    /// @return 요소의 참조
+    T& GetAt(SlotHandle handle)
+    {
+        T* value = Find(handle);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("SlotMap::GetAt - invalid handle");
+        }
+        return *value;
+    }
+
+    /// @brief 핸들로 요소 접근 (유효성 검사, 잘못된 핸들이면 예외, const 버전)
+    /// @param handle 요소의 핸들
+    /// @return 요소의 const 참조
+    const T& GetAt(SlotHandle handle) const
+    {
+        const T* value = Find(handle);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("SlotMap::GetAt - invalid handle");
+        }
+        return *value;
+    }
+
+    /// @brief 연속 배열 위치에 있는 요소의 핸들 반환
+    /// @param denseIndex 연속 배열 인덱스 (GetSize() 미만)
+    /// @return 해당 요소의 핸들
+    SlotHandle GetHandleAt(uint64 denseIndex) const
+    {
+        const uint32 slotIndex = m_denseToSlot[denseIndex];
+        return SlotHandle(slotIndex, m_slots[slotIndex].generation);
+    }
+
+    /// @brief 모든 요소 제거 (발급된 핸들은 모두 무효화)
+    void Clear()
+    {
+        for (uint64 i = 0; i < m_denseToSlot.GetSize(); ++i)
+        {
+            const uint32 slotIndex = m_denseToSlot[i];
+            ++m_slots[slotIndex].generation;
+            ReleaseSlot(slotIndex);
+        }
+        m_values.Clear();
+        m_denseToSlot.Clear();
+    }
+
+    /// @brief 요소 용량 예약
+    /// @param capacity 예약할 요소 개수
+    void Reserve(uint64 capacity)
+    {
+        m_values.Reserve(capacity);
+        m_denseToSlot.Reserve(capacity);
+        m_slots.Reserve(capacity);
+    }
+
+    /// @brief 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_values.GetSize();
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_values.IsEmpty();
+    }
+
+    /// @brief 연속 배열의 원시 데이터 포인터 반환
+    /// @return 첫 번째 요소를 가리키는 포인터
+    T* GetData()
+    {
+        return m_values.GetData();
+    }
+
+    /// @brief 연속 배열의 원시 데이터 포인터 반환 (const 버전)
+    /// @return 첫 번째 요소를 가리키는 const 포인터
+    const T* GetData() const
+    {
+        return m_values.GetData();
+    }
+
+    /// @brief 연속 배열 인덱스로 요소 접근 (경계 검사 없음)
+    /// @param denseIndex 연속 배열 인덱스
+    /// @return 요소의 참조
+    T& operator[](uint64 denseIndex)
+    {
+        return m_values[denseIndex];
+    }
+
+    /// @brief 연속 배열 인덱스로 요소 접근 (경계 검사 없음, const 버전)
+    /// @param denseIndex 연속 배열 인덱스
+    /// @return 요소의 const 참조
+    const T& operator[](uint64 denseIndex) const
+    {
+        return m_values[denseIndex];
+    }
+
+    /// @brief 시작 반복자 반환
+    /// @return 시작 반복자
+    Iterator Begin()
+    {
+        return m_values.Begin();
+    }
+
+    /// @brief 시작 반복자 반환 (const 버전)
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return m_values.Begin();
+    }
+
+    /// @brief 끝 반복자 반환
+    /// @return 끝 반복자
+    Iterator End()
+    {
+        return m_values.End();
+    }
+
+    /// @brief 끝 반복자 반환 (const 버전)
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return m_values.End();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 복사본
+    Alloc GetAllocator() const
+    {
+        return m_values.GetAllocator();
+    }
+
+    // Range-based for loop 지원
+    Iterator begin() { return m_values.Begin(); }
+    ConstIterator begin() const { return m_values.Begin(); }
+    Iterator end() { return m_values.End(); }
+    ConstIterator end() const { return m_values.End(); }
+
+private:
+    /// @brief free list에서 빈 슬롯을 꺼내거나 새 슬롯 추가
+    uint32 AcquireSlot()
+    {
+        if (m_freeHead != INVALID_INDEX)
+        {
+            const uint32 slotIndex = m_freeHead;
+            m_freeHead = m_slots[slotIndex].nextFree;
+            return slotIndex;
+        }
+
+        if (m_slots.GetSize() >= INVALID_INDEX)
+        {
+            throw std::length_error("SlotMap::Insert - too many slots");
+        }
+
+        Slot slot;
+        slot.nextFree = INVALID_INDEX;
+        slot.generation = 0;
+        m_slots.Add(slot);
+        return static_cast<uint32>(m_slots.GetSize() - 1);
+    }
+
+    /// @brief 빈 슬롯을 free list 앞에 연결 (세대는 이미 짝수여야 함)
+    void ReleaseSlot(uint32 slotIndex)
+    {
+        m_slots[slotIndex].nextFree = m_freeHead;
+        m_freeHead = slotIndex;
+    }
+
+    StorageType m_values;
+    DynamicArray<uint32, Alloc> m_denseToSlot;
+    DynamicArray<Slot, Alloc> m_slots;
+    uint32 m_freeHead;
+};
+
+} // namespace Excep
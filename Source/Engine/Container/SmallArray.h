@@ -0,0 +1,472 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Memory/Allocator.h"
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 처음 N개의 요소를 객체 내부에 저장하고 초과 시에만 힙을 사용하는 동적 배열 컨테이너
+/// @tparam T 저장할 요소의 타입
+/// @tparam N 내부(inline) 저장 용량
+/// @tparam Alloc N개를 초과했을 때 사용할 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note DynamicArray와 같은 API를 제공합니다. 요소 개수가 N 이하인 동안은 힙 할당이 발생하지 않습니다.
+template<typename T, uint64 N, typename Alloc = DefaultAllocator>
+class SmallArray : private Alloc
+{
+public:
+    static_assert(N > 0, "SmallArray inline capacity must be greater than 0");
+
+    using Iterator = T*;
+    using ConstIterator = const T*;
+
+    /// @brief 기본 생성자
+    SmallArray()
+        : m_data(GetInlineData())
+        , m_size(0)
+        , m_capacity(N)
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit SmallArray(const Alloc& allocator)
+        : Alloc(allocator)
+        , m_data(GetInlineData())
+        , m_size(0)
+        , m_capacity(N)
+    {
+    }
+
+    /// @brief 크기를 지정하여 생성
+    /// @param size 초기 크기
+    explicit SmallArray(uint64 size)
+        : SmallArray()
+    {
+        Resize(size);
+    }
+
+    /// @brief 크기와 초기값을 지정하여 생성
+    /// @param size 초기 크기
+    /// @param value 초기값
+    SmallArray(uint64 size, const T& value)
+        : SmallArray()
+    {
+        Resize(size, value);
+    }
+
+    /// @brief 초기화 리스트로 생성
+    /// @param initList 초기화 리스트
+    SmallArray(std::initializer_list<T> initList)
+        : SmallArray()
+    {
+        Reserve(static_cast<uint64>(initList.size()));
+        for (const auto& value : initList)
+        {
+            Add(value);
+        }
+    }
+
+    /// @brief 복사 생성자
+    /// @param other 복사할 SmallArray
+    SmallArray(const SmallArray& other)
+        : SmallArray(other.GetAllocator())
+    {
+        Reserve(other.m_size);
+        for (uint64 i = 0; i < other.m_size; ++i)
+        {
+            new (m_data + i) T(other.m_data[i]);
+        }
+        m_size = other.m_size;
+    }
+
+    /// @brief 이동 생성자
+    /// @param other 이동할 SmallArray
+    SmallArray(SmallArray&& other) noexcept
+        : SmallArray(other.GetAllocator())
+    {
+        MoveFrom(other);
+    }
+
+    ~SmallArray()
+    {
+        Clear();
+        FreeHeap();
+    }
+
+    /// @brief 복사 대입 연산자
+    /// @param other 복사할 SmallArray
+    /// @return 자기 자신의 참조
+    SmallArray& operator=(const SmallArray& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            Reserve(other.m_size);
+            for (uint64 i = 0; i < other.m_size; ++i)
+            {
+                new (m_data + i) T(other.m_data[i]);
+            }
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    /// @brief 이동 대입 연산자
+    /// @param other 이동할 SmallArray
+    /// @return 자기 자신의 참조
+    SmallArray& operator=(SmallArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            FreeHeap();
+            static_cast<Alloc&>(*this) = other.GetAllocator();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    /// @brief 배열 끝에 요소 추가
+    /// @param value 추가할 요소
+    void Add(const T& value)
+    {
+        if (m_size == m_capacity)
+        {
+            // value가 이 배열의 요소일 수 있으므로 재할당 전에 복사
+            T temp(value);
+            Grow(m_capacity * 2);
+            new (m_data + m_size) T(std::move(temp));
+        }
+        else
+        {
+            new (m_data + m_size) T(value);
+        }
+        ++m_size;
+    }
+
+    /// @brief 배열 끝에 요소 추가 (move semantics)
+    /// @param value 추가할 요소
+    void Add(T&& value)
+    {
+        if (m_size == m_capacity)
+        {
+            T temp(std::move(value));
+            Grow(m_capacity * 2);
+            new (m_data + m_size) T(std::move(temp));
+        }
+        else
+        {
+            new (m_data + m_size) T(std::move(value));
+        }
+        ++m_size;
+    }
+
+    /// @brief 특정 값을 가진 첫 번째 요소 제거
+    /// @param value 제거할 값
+    /// @return 제거 성공 시 true, 값을 찾지 못한 경우 false
+    bool8 Remove(const T& value)
+    {
+        for (uint64 i = 0; i < m_size; ++i)
+        {
+            if (m_data[i] == value)
+            {
+                RemoveAt(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief 특정 인덱스의 요소 제거
+    /// @param index 제거할 요소의 인덱스
+    void RemoveAt(uint64 index)
+    {
+        for (uint64 i = index; i + 1 < m_size; ++i)
+        {
+            m_data[i] = std::move(m_data[i + 1]);
+        }
+        Pop();
+    }
+
+    /// @brief 마지막 요소 제거
+    void Pop()
+    {
+        --m_size;
+        m_data[m_size].~T();
+    }
+
+    /// @brief 배열의 모든 요소 제거 (용량은 유지)
+    void Clear()
+    {
+        for (uint64 i = 0; i < m_size; ++i)
+        {
+            m_data[i].~T();
+        }
+        m_size = 0;
+    }
+
+    /// @brief 배열의 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_size;
+    }
+
+    /// @brief 배열의 용량 반환
+    /// @return 재할당 없이 담을 수 있는 요소 개수
+    uint64 GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /// @brief 요소들이 객체 내부 저장소에 있는지 확인
+    /// @return 힙을 사용하지 않으면 true
+    bool8 IsInline() const
+    {
+        return m_data == GetInlineData();
+    }
+
+    /// @brief 배열이 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// @brief 배열의 용량 예약
+    /// @param capacity 예약할 용량
+    void Reserve(uint64 capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            Grow(capacity);
+        }
+    }
+
+    /// @brief 배열의 크기 변경
+    /// @param newSize 새로운 크기
+    void Resize(uint64 newSize)
+    {
+        Reserve(newSize);
+        while (m_size > newSize)
+        {
+            Pop();
+        }
+        for (; m_size < newSize; ++m_size)
+        {
+            new (m_data + m_size) T();
+        }
+    }
+
+    /// @brief 배열의 크기 변경 (기본값 지정)
+    /// @param newSize 새로운 크기
+    /// @param value 새로 추가되는 요소의 기본값
+    void Resize(uint64 newSize, const T& value)
+    {
+        Reserve(newSize);
+        while (m_size > newSize)
+        {
+            Pop();
+        }
+        for (; m_size < newSize; ++m_size)
+        {
+            new (m_data + m_size) T(value);
+        }
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 없음)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 참조
+    T& operator[](uint64 index)
+    {
+        return m_data[index];
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 없음, const 버전)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 const 참조
+    const T& operator[](uint64 index) const
+    {
+        return m_data[index];
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 수행)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 참조
+    T& GetAt(uint64 index)
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("SmallArray::GetAt - index out of range");
+        }
+        return m_data[index];
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 수행, const 버전)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 const 참조
+    const T& GetAt(uint64 index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("SmallArray::GetAt - index out of range");
+        }
+        return m_data[index];
+    }
+
+    /// @brief 배열의 첫 번째 요소 참조 반환
+    /// @return 첫 번째 요소의 참조
+    T& GetFront()
+    {
+        return m_data[0];
+    }
+
+    /// @brief 배열의 첫 번째 요소 참조 반환 (const 버전)
+    /// @return 첫 번째 요소의 const 참조
+    const T& GetFront() const
+    {
+        return m_data[0];
+    }
+
+    /// @brief 배열의 마지막 요소 참조 반환
+    /// @return 마지막 요소의 참조
+    T& GetBack()
+    {
+        return m_data[m_size - 1];
+    }
+
+    /// @brief 배열의 마지막 요소 참조 반환 (const 버전)
+    /// @return 마지막 요소의 const 참조
+    const T& GetBack() const
+    {
+        return m_data[m_size - 1];
+    }
+
+    /// @brief 배열의 원시 데이터 포인터 반환
+    /// @return 배열의 첫 번째 요소를 가리키는 포인터
+    T* GetData()
+    {
+        return m_data;
+    }
+
+    /// @brief 배열의 원시 데이터 포인터 반환 (const 버전)
+    /// @return 배열의 첫 번째 요소를 가리키는 const 포인터
+    const T* GetData() const
+    {
+        return m_data;
+    }
+
+    /// @brief 배열의 시작 반복자 반환
+    /// @return 시작 반복자
+    Iterator Begin()
+    {
+        return m_data;
+    }
+
+    /// @brief 배열의 시작 반복자 반환 (const 버전)
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return m_data;
+    }
+
+    /// @brief 배열의 끝 반복자 반환
+    /// @return 끝 반복자
+    Iterator End()
+    {
+        return m_data + m_size;
+    }
+
+    /// @brief 배열의 끝 반복자 반환 (const 버전)
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return m_data + m_size;
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return *this;
+    }
+
+    // Range-based for loop 지원
+    Iterator begin() { return m_data; }
+    ConstIterator begin() const { return m_data; }
+    Iterator end() { return m_data + m_size; }
+    ConstIterator end() const { return m_data + m_size; }
+
+private:
+    T* GetInlineData()
+    {
+        return reinterpret_cast<T*>(m_inline);
+    }
+
+    const T* GetInlineData() const
+    {
+        return reinterpret_cast<const T*>(m_inline);
+    }
+
+    /// @brief 힙 버퍼로 옮기면서 용량 확장
+    void Grow(uint64 newCapacity)
+    {
+        T* newData = static_cast<T*>(Alloc::Allocate(newCapacity * sizeof(T), alignof(T)));
+        for (uint64 i = 0; i < m_size; ++i)
+        {
+            new (newData + i) T(std::move(m_data[i]));
+            m_data[i].~T();
+        }
+
+        FreeHeap();
+        m_data = newData;
+        m_capacity = newCapacity;
+    }
+
+    void FreeHeap()
+    {
+        if (!IsInline())
+        {
+            Alloc::Deallocate(m_data, m_capacity * sizeof(T), alignof(T));
+            m_data = GetInlineData();
+            m_capacity = N;
+        }
+    }
+
+    /// @brief other의 요소를 가져옴 (this는 비어있는 inline 상태이고 other와 같은 할당자여야 함)
+    void MoveFrom(SmallArray& other)
+    {
+        // 인라인 요소는 버퍼를 넘겨받을 수 없으므로 하나씩 이동
+        if (other.IsInline())
+        {
+            Reserve(other.m_size);
+            for (uint64 i = 0; i < other.m_size; ++i)
+            {
+                new (m_data + i) T(std::move(other.m_data[i]));
+            }
+            m_size = other.m_size;
+            other.Clear();
+        }
+        else
+        {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = other.GetInlineData();
+            other.m_size = 0;
+            other.m_capacity = N;
+        }
+    }
+
+    T* m_data;
+    uint64 m_size;
+    uint64 m_capacity;
+    alignas(T) uint8 m_inline[N * sizeof(T)];
+};
+
+} // namespace Excep
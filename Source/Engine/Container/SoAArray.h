@@ -0,0 +1,410 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include "Container/IteratorRange.h"
+#include "Memory/Allocator.h"
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+namespace SoADetail
+{
+
+template<bool8... Values>
+struct BoolPack
+{
+};
+
+/// @brief 모든 조건이 true인지 확인 (BoolPack을 한 칸 밀어서 비교)
+template<bool8... Values>
+using AllOf = std::is_same<BoolPack<true, Values...>, BoolPack<Values..., true>>;
+
+} // namespace SoADetail
+
+/// @brief 요소의 각 필드를 필드별 연속 배열(열)에 나누어 저장하는 Struct-of-Arrays 컨테이너
+/// @tparam Alloc 엔진 할당자 타입
+/// @tparam Fields 필드 타입 목록 (trivially copyable이어야 함)
+/// @note 일반적으로는 SoAArray<Fields...> 별칭을 사용합니다.
+///       모든 열은 할당 한 번으로 얻은 블록 안에 COLUMN_ALIGNMENT 경계로 정렬되어 놓이므로,
+///       GetData<I>()/GetColumn<I>()로 얻은 열 하나를 순회하는 루프는 필요한 필드만 읽고 컴파일러가 SIMD로 벡터화하기 쉽습니다.
+///       Add/RemoveSwap/Resize는 모든 열에 함께 적용되어 같은 인덱스가 항상 같은 요소를 가리킵니다.
+template<typename Alloc, typename... Fields>
+class BasicSoAArray : private Alloc
+{
+public:
+    /// @brief 필드(열) 개수
+    static constexpr uint64 FIELD_COUNT = sizeof...(Fields);
+
+    /// @brief 각 열의 시작 주소 정렬 (캐시 라인 = AVX-512 레지스터 크기)
+    static constexpr uint64 COLUMN_ALIGNMENT = CACHE_LINE_SIZE;
+
+    static_assert(FIELD_COUNT > 0, "SoAArray needs at least one field");
+    static_assert(SoADetail::AllOf<std::is_trivially_copyable<Fields>::value...>::value,
+                  "SoAArray fields must be trivially copyable");
+    static_assert(SoADetail::AllOf<(alignof(Fields) <= CACHE_LINE_SIZE)...>::value,
+                  "SoAArray field alignment must not exceed CACHE_LINE_SIZE");
+
+    /// @brief I번째 필드 타입
+    template<uint64 I>
+    using FieldType = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+    /// @brief 기본 생성자
+    BasicSoAArray()
+        : m_size(0)
+        , m_capacity(0)
+    {
+        ResetColumns();
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit BasicSoAArray(const Alloc& allocator)
+        : Alloc(allocator)
+        , m_size(0)
+        , m_capacity(0)
+    {
+        ResetColumns();
+    }
+
+    /// @brief 복사 생성자
+    /// @param other 복사할 SoAArray
+    BasicSoAArray(const BasicSoAArray& other)
+        : BasicSoAArray(other.GetAllocator())
+    {
+        CopyFrom(other);
+    }
+
+    /// @brief 이동 생성자 (열 블록을 넘겨받음)
+    /// @param other 이동할 SoAArray
+    BasicSoAArray(BasicSoAArray&& other) noexcept
+        : Alloc(other.GetAllocator())
+        , m_size(other.m_size)
+        , m_capacity(other.m_capacity)
+    {
+        std::memcpy(m_columns, other.m_columns, sizeof(m_columns));
+        other.ResetColumns();
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
+    ~BasicSoAArray()
+    {
+        FreeBlock();
+    }
+
+    /// @brief 복사 대입 연산자
+    /// @param other 복사할 SoAArray
+    /// @return 자기 자신의 참조
+    BasicSoAArray& operator=(const BasicSoAArray& other)
+    {
+        if (this != &other)
+        {
+            m_size = 0;
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    /// @brief 이동 대입 연산자
+    /// @param other 이동할 SoAArray
+    /// @return 자기 자신의 참조
+    BasicSoAArray& operator=(BasicSoAArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            FreeBlock();
+            static_cast<Alloc&>(*this) = other.GetAllocator();
+            std::memcpy(m_columns, other.m_columns, sizeof(m_columns));
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.ResetColumns();
+            other.m_size = 0;
+            other.m_capacity = 0;
+        }
+        return *this;
+    }
+
+    /// @brief 모든 열의 끝에 필드 값을 하나씩 추가
+    /// @param values 필드 순서대로의 값
+    /// @return 추가된 요소의 인덱스
+    uint64 Add(const Fields&... values)
+    {
+        if (m_size == m_capacity)
+        {
+            // values가 이 배열의 요소일 수 있으므로 재할당 전에 복사
+            return AddAfterGrow(values...);
+        }
+        ConstructAt(m_size, std::index_sequence_for<Fields...>(), values...);
+        return m_size++;
+    }
+
+    /// @brief 요소를 마지막 요소와 바꾼 뒤 제거 (순서 유지 안 함, O(필드 수))
+    /// @param index 제거할 요소의 인덱스
+    void RemoveSwap(uint64 index)
+    {
+        const uint64 last = m_size - 1;
+        if (index != last)
+        {
+            const uint64 fieldSizes[] = { sizeof(Fields)... };
+            for (uint64 i = 0; i < FIELD_COUNT; ++i)
+            {
+                uint8* column = m_columns[i];
+                std::memcpy(column + index * fieldSizes[i], column + last * fieldSizes[i], fieldSizes[i]);
+            }
+        }
+        m_size = last;
+    }
+
+    /// @brief 마지막 요소 제거
+    void Pop()
+    {
+        --m_size;
+    }
+
+    /// @brief 모든 요소 제거 (용량은 유지)
+    void Clear()
+    {
+        m_size = 0;
+    }
+
+    /// @brief 모든 열의 크기 변경 (새 요소의 필드는 기본 생성)
+    /// @param newSize 새로운 크기
+    void Resize(uint64 newSize)
+    {
+        Reserve(newSize);
+        for (; m_size < newSize; ++m_size)
+        {
+            ConstructDefaultAt(m_size, std::index_sequence_for<Fields...>());
+        }
+        m_size = newSize;
+    }
+
+    /// @brief 모든 열의 용량 예약
+    /// @param capacity 예약할 요소 개수
+    void Reserve(uint64 capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            Grow(capacity);
+        }
+    }
+
+    /// @brief 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_size;
+    }
+
+    /// @brief 용량 반환
+    /// @return 재할당 없이 담을 수 있는 요소 개수
+    uint64 GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// @brief I번째 열의 원시 데이터 포인터 반환 (COLUMN_ALIGNMENT로 정렬됨)
+    /// @return 열의 첫 번째 요소를 가리키는 포인터 (용량이 0이면 nullptr)
+    template<uint64 I>
+    FieldType<I>* GetData()
+    {
+        return reinterpret_cast<FieldType<I>*>(m_columns[I]);
+    }
+
+    /// @brief I번째 열의 원시 데이터 포인터 반환 (const 버전)
+    /// @return 열의 첫 번째 요소를 가리키는 const 포인터 (용량이 0이면 nullptr)
+    template<uint64 I>
+    const FieldType<I>* GetData() const
+    {
+        return reinterpret_cast<const FieldType<I>*>(m_columns[I]);
+    }
+
+    /// @brief I번째 열 전체 범위 반환
+    /// @return [0, GetSize()) 범위 (Add/Reserve/Resize로 재할당되면 무효화됨)
+    template<uint64 I>
+    IteratorRange<FieldType<I>*> GetColumn()
+    {
+        return IteratorRange<FieldType<I>*>(GetData<I>(), GetData<I>() + m_size);
+    }
+
+    /// @brief I번째 열 전체 범위 반환 (const 버전)
+    /// @return [0, GetSize()) const 범위 (Add/Reserve/Resize로 재할당되면 무효화됨)
+    template<uint64 I>
+    IteratorRange<const FieldType<I>*> GetColumn() const
+    {
+        return IteratorRange<const FieldType<I>*>(GetData<I>(), GetData<I>() + m_size);
+    }
+
+    /// @brief 요소의 I번째 필드 접근 (경계 검사 없음)
+    /// @param index 요소의 인덱스
+    /// @return 필드의 참조
+    template<uint64 I>
+    FieldType<I>& Get(uint64 index)
+    {
+        return GetData<I>()[index];
+    }
+
+    /// @brief 요소의 I번째 필드 접근 (경계 검사 없음, const 버전)
+    /// @param index 요소의 인덱스
+    /// @return 필드의 const 참조
+    template<uint64 I>
+    const FieldType<I>& Get(uint64 index) const
+    {
+        return GetData<I>()[index];
+    }
+
+    /// @brief 요소의 I번째 필드 접근 (경계 검사 수행)
+    /// @param index 요소의 인덱스
+    /// @return 필드의 참조
+    template<uint64 I>
+    FieldType<I>& GetAt(uint64 index)
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("SoAArray::GetAt - index out of range");
+        }
+        return GetData<I>()[index];
+    }
+
+    /// @brief 요소의 I번째 필드 접근 (경계 검사 수행, const 버전)
+    /// @param index 요소의 인덱스
+    /// @return 필드의 const 참조
+    template<uint64 I>
+    const FieldType<I>& GetAt(uint64 index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range("SoAArray::GetAt - index out of range");
+        }
+        return GetData<I>()[index];
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return *this;
+    }
+
+private:
+    static uint64 AlignUp(uint64 value)
+    {
+        return (value + COLUMN_ALIGNMENT - 1) & ~(COLUMN_ALIGNMENT - 1);
+    }
+
+    /// @brief capacity개를 담는 블록의 바이트 수와 열별 시작 오프셋 계산
+    static uint64 ComputeLayout(uint64 capacity, uint64 (&outOffsets)[FIELD_COUNT])
+    {
+        const uint64 fieldSizes[] = { sizeof(Fields)... };
+        uint64 bytes = 0;
+        for (uint64 i = 0; i < FIELD_COUNT; ++i)
+        {
+            outOffsets[i] = bytes;
+            bytes += AlignUp(fieldSizes[i] * capacity);
+        }
+        return bytes;
+    }
+
+    template<std::size_t... I>
+    void ConstructAt(uint64 index, std::index_sequence<I...>, const Fields&... values)
+    {
+        using Expand = int32[];
+        (void)Expand{ 0, (new (GetData<I>() + index) Fields(values), 0)... };
+    }
+
+    template<std::size_t... I>
+    void ConstructDefaultAt(uint64 index, std::index_sequence<I...>)
+    {
+        using Expand = int32[];
+        (void)Expand{ 0, (new (GetData<I>() + index) Fields(), 0)... };
+    }
+
+    uint64 AddAfterGrow(Fields... values)
+    {
+        Grow(m_capacity == 0 ? 16 : m_capacity * 2);
+        ConstructAt(m_size, std::index_sequence_for<Fields...>(), values...);
+        return m_size++;
+    }
+
+    /// @brief 새 블록으로 열들을 옮기면서 용량 확장
+    void Grow(uint64 newCapacity)
+    {
+        uint64 offsets[FIELD_COUNT];
+        const uint64 bytes = ComputeLayout(newCapacity, offsets);
+        uint8* newBlock = static_cast<uint8*>(Alloc::Allocate(bytes, COLUMN_ALIGNMENT));
+
+        const uint64 fieldSizes[] = { sizeof(Fields)... };
+        for (uint64 i = 0; i < FIELD_COUNT; ++i)
+        {
+            if (m_size > 0)
+            {
+                std::memcpy(newBlock + offsets[i], m_columns[i], fieldSizes[i] * m_size);
+            }
+        }
+
+        FreeBlock();
+        for (uint64 i = 0; i < FIELD_COUNT; ++i)
+        {
+            m_columns[i] = newBlock + offsets[i];
+        }
+        m_capacity = newCapacity;
+    }
+
+    void CopyFrom(const BasicSoAArray& other)
+    {
+        Reserve(other.m_size);
+        const uint64 fieldSizes[] = { sizeof(Fields)... };
+        for (uint64 i = 0; i < FIELD_COUNT; ++i)
+        {
+            if (other.m_size > 0)
+            {
+                std::memcpy(m_columns[i], other.m_columns[i], fieldSizes[i] * other.m_size);
+            }
+        }
+        m_size = other.m_size;
+    }
+
+    /// @brief 열 블록 해제 (첫 번째 열이 블록의 시작)
+    void FreeBlock()
+    {
+        if (m_capacity > 0)
+        {
+            uint64 offsets[FIELD_COUNT];
+            Alloc::Deallocate(m_columns[0], ComputeLayout(m_capacity, offsets), COLUMN_ALIGNMENT);
+            ResetColumns();
+            m_capacity = 0;
+        }
+    }
+
+    void ResetColumns()
+    {
+        for (uint64 i = 0; i < FIELD_COUNT; ++i)
+        {
+            m_columns[i] = nullptr;
+        }
+    }
+
+    uint8* m_columns[FIELD_COUNT];
+    uint64 m_size;
+    uint64 m_capacity;
+};
+
+/// @brief 기본 할당자를 사용하는 Struct-of-Arrays 컨테이너
+template<typename... Fields>
+using SoAArray = BasicSoAArray<DefaultAllocator, Fields...>;
+
+} // namespace Excep
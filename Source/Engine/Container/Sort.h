@@ -0,0 +1,307 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/DynamicArray.h"
+#include "Memory/Allocator.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief ParallelSort가 여러 스레드로 나누기 시작하는 요소 개수
+constexpr uint64 PARALLEL_SORT_THRESHOLD = 1ull << 15;
+
+/// @brief ParallelSort가 사용하는 최대 스레드 개수
+constexpr uint64 MAX_SORT_THREAD_COUNT = 16;
+
+namespace SortDetail
+{
+
+/// @brief 시작한 스레드가 모두 끝날 때까지 대기
+inline void JoinAll(DynamicArray<std::thread>& threads)
+{
+    for (uint64 i = 0; i < threads.GetSize(); ++i)
+    {
+        threads[i].join();
+    }
+}
+
+/// @brief task(0) ~ task(taskCount - 1)을 각각 다른 스레드에서 실행하고 모두 끝날 때까지 대기
+/// @note 마지막 작업 하나는 호출한 스레드에서 실행합니다.
+///       스레드를 만들지 못하면 남은 작업을 모두 호출한 스레드에서 실행하며,
+///       호출한 스레드의 작업이 예외를 던져도 시작한 스레드를 모두 join한 뒤 다시 던집니다.
+template<typename Task>
+void RunParallel(uint64 taskCount, const Task& task)
+{
+    // 미리 예약하여 Emplace가 재할당(예외)하지 않도록 함 (join하지 않은 스레드가 소멸되면 terminate)
+    DynamicArray<std::thread> threads;
+    threads.Reserve(taskCount - 1);
+
+    uint64 next = 0;
+    try
+    {
+        for (; next + 1 < taskCount; ++next)
+        {
+            const uint64 index = next;
+            threads.Emplace([&task, index]() { task(index); });
+        }
+    }
+    catch (...)
+    {
+        // 스레드 생성 실패(std::system_error 등): 아래에서 남은 작업을 직접 실행
+    }
+
+    try
+    {
+        for (; next < taskCount; ++next)
+        {
+            task(next);
+        }
+    }
+    catch (...)
+    {
+        JoinAll(threads);
+        throw;
+    }
+    JoinAll(threads);
+}
+
+/// @brief 사용할 정렬 스레드 개수 (하드웨어 스레드 수 이하의 2의 거듭제곱)
+inline uint64 GetSortThreadCount(uint64 count)
+{
+    uint64 threadCount = std::thread::hardware_concurrency();
+    if (threadCount > MAX_SORT_THREAD_COUNT)
+    {
+        threadCount = MAX_SORT_THREAD_COUNT;
+    }
+
+    // 스레드당 요소가 너무 적으면 스레드 생성 비용이 더 큼
+    while (threadCount > 1 && count / threadCount < PARALLEL_SORT_THRESHOLD / 2)
+    {
+        threadCount /= 2;
+    }
+
+    uint64 powerOfTwo = 1;
+    while (powerOfTwo * 2 <= threadCount)
+    {
+        powerOfTwo *= 2;
+    }
+    return powerOfTwo;
+}
+
+} // namespace SortDetail
+
+/// @brief 배열 정렬 (불안정 정렬, O(n log n))
+/// @param data 배열
+/// @param count 요소 개수
+/// @param less 비교 함수 객체 (기본값: operator<)
+template<typename T, typename Compare = std::less<>>
+void Sort(T* data, uint64 count, Compare less = Compare())
+{
+    std::sort(data, data + count, less);
+}
+
+/// @brief DynamicArray 정렬 (불안정 정렬, O(n log n))
+/// @param array 정렬할 배열
+/// @param less 비교 함수 객체 (기본값: operator<)
+template<typename T, typename Alloc, typename Compare = std::less<>>
+void Sort(DynamicArray<T, Alloc>& array, Compare less = Compare())
+{
+    Sort(array.GetData(), array.GetSize(), less);
+}
+
+/// @brief 배열 정렬 (같은 요소의 원래 순서 유지, O(n log n))
+/// @param data 배열
+/// @param count 요소 개수
+/// @param less 비교 함수 객체 (기본값: operator<)
+template<typename T, typename Compare = std::less<>>
+void StableSort(T* data, uint64 count, Compare less = Compare())
+{
+    std::stable_sort(data, data + count, less);
+}
+
+/// @brief DynamicArray 정렬 (같은 요소의 원래 순서 유지, O(n log n))
+/// @param array 정렬할 배열
+/// @param less 비교 함수 객체 (기본값: operator<)
+template<typename T, typename Alloc, typename Compare = std::less<>>
+void StableSort(DynamicArray<T, Alloc>& array, Compare less = Compare())
+{
+    StableSort(array.GetData(), array.GetSize(), less);
+}
+
+/// @brief 요소 자체를 Radix 정렬 Key로 사용 (uint32/uint64 배열용)
+struct RadixIdentityKey
+{
+    template<typename Key>
+    Key operator()(Key key) const
+    {
+        return key;
+    }
+};
+
+/// @brief 부호 있는 정수를 정렬 순서가 같은 부호 없는 Radix Key로 변환
+inline uint32 ToRadixKey(int32 value)
+{
+    return static_cast<uint32>(value) ^ 0x80000000u;
+}
+
+/// @brief 부호 있는 정수를 정렬 순서가 같은 부호 없는 Radix Key로 변환
+inline uint64 ToRadixKey(int64 value)
+{
+    return static_cast<uint64>(value) ^ 0x8000000000000000ull;
+}
+
+/// @brief 실수를 정렬 순서가 같은 부호 없는 Radix Key로 변환 (-0은 +0보다 앞, NaN은 양 끝)
+inline uint32 ToRadixKey(float32 value)
+{
+    uint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+/// @brief 실수를 정렬 순서가 같은 부호 없는 Radix Key로 변환 (-0은 +0보다 앞, NaN은 양 끝)
+inline uint64 ToRadixKey(float64 value)
+{
+    uint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+}
+
+/// @brief 정수 Key 기준 LSD Radix 정렬 (안정 정렬, O(n × Key 바이트 수))
+/// @param data 배열 (T는 trivially copyable이어야 함)
+/// @param count 요소 개수
+/// @param keyOf 요소에서 uint32 또는 uint64 Key를 꺼내는 함수 객체 (기본값: 요소 자체)
+/// @param allocator 임시 버퍼에 사용할 할당자
+/// @note 8비트 자릿수마다 한 번씩 배열을 분배하며, 모든 요소의 자릿수가 같으면 그 단계는 건너뜁니다.
+///       자릿수별 개수는 첫 순회에서 한꺼번에 세므로 Key는 (단계 수 + 1)번 꺼냅니다.
+///       비교 정렬보다 요소가 많을수록 유리하며, 드로우 정렬 Key나 오브젝트 ID 정렬에 사용합니다.
+///       부호 있는 정수/실수 Key는 ToRadixKey로 변환하여 반환합니다.
+template<typename T, typename KeyOf = RadixIdentityKey, typename Alloc = DefaultAllocator>
+void RadixSort(T* data, uint64 count, KeyOf keyOf = KeyOf(), const Alloc& allocator = Alloc())
+{
+    using Key = typename std::decay<decltype(keyOf(*data))>::type;
+    static_assert(std::is_same<Key, uint32>::value || std::is_same<Key, uint64>::value,
+                  "RadixSort key must be uint32 or uint64");
+    static_assert(std::is_trivially_copyable<T>::value, "RadixSort requires a trivially copyable element type");
+
+    const uint64 RADIX_BITS = 8;
+    const uint64 BUCKET_COUNT = 1ull << RADIX_BITS;
+    const uint64 PASS_COUNT = sizeof(Key);
+
+    if (count < 2)
+    {
+        return;
+    }
+
+    uint64 histograms[sizeof(Key)][BUCKET_COUNT] = {};
+    for (uint64 i = 0; i < count; ++i)
+    {
+        const Key key = keyOf(data[i]);
+        for (uint64 pass = 0; pass < PASS_COUNT; ++pass)
+        {
+            ++histograms[pass][(key >> (pass * RADIX_BITS)) & (BUCKET_COUNT - 1)];
+        }
+    }
+
+    Alloc bufferAllocator(allocator);
+    T* buffer = static_cast<T*>(bufferAllocator.Allocate(count * sizeof(T), alignof(T)));
+    T* source = data;
+    T* destination = buffer;
+
+    for (uint64 pass = 0; pass < PASS_COUNT; ++pass)
+    {
+        const uint64 shift = pass * RADIX_BITS;
+        uint64* histogram = histograms[pass];
+
+        // 모든 요소가 같은 버킷이면 순서가 바뀌지 않음
+        if (histogram[(keyOf(source[0]) >> shift) & (BUCKET_COUNT - 1)] == count)
+        {
+            continue;
+        }
+
+        // 버킷별 개수 → 버킷 시작 위치
+        uint64 offset = 0;
+        for (uint64 bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+        {
+            const uint64 bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        for (uint64 i = 0; i < count; ++i)
+        {
+            const uint64 bucket = (keyOf(source[i]) >> shift) & (BUCKET_COUNT - 1);
+            std::memcpy(&destination[histogram[bucket]++], &source[i], sizeof(T));
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != data)
+    {
+        std::memcpy(data, source, count * sizeof(T));
+    }
+    bufferAllocator.Deallocate(buffer, count * sizeof(T), alignof(T));
+}
+
+/// @brief 정수 Key 기준 DynamicArray LSD Radix 정렬 (안정 정렬)
+/// @param array 정렬할 배열 (임시 버퍼는 배열의 할당자를 사용)
+/// @param keyOf 요소에서 uint32 또는 uint64 Key를 꺼내는 함수 객체 (기본값: 요소 자체)
+template<typename T, typename Alloc, typename KeyOf = RadixIdentityKey>
+void RadixSort(DynamicArray<T, Alloc>& array, KeyOf keyOf = KeyOf())
+{
+    RadixSort(array.GetData(), array.GetSize(), keyOf, array.GetAllocator());
+}
+
+/// @brief 여러 스레드로 배열 정렬 (불안정 정렬)
+/// @param data 배열
+/// @param count 요소 개수
+/// @param less 비교 함수 객체 (기본값: operator<, 여러 스레드에서 동시에 호출되며 예외를 던지면 안 됨)
+/// @note 요소가 PARALLEL_SORT_THRESHOLD 미만이거나 하드웨어 스레드가 하나뿐이면 Sort와 같습니다.
+///       배열을 스레드 수만큼 나누어 동시에 정렬한 뒤, 이웃한 구간끼리 병합하는 단계를 병렬로 반복합니다.
+template<typename T, typename Compare = std::less<>>
+void ParallelSort(T* data, uint64 count, Compare less = Compare())
+{
+    const uint64 threadCount = (count < PARALLEL_SORT_THRESHOLD) ? 1 : SortDetail::GetSortThreadCount(count);
+    if (threadCount < 2)
+    {
+        Sort(data, count, less);
+        return;
+    }
+
+    uint64 bounds[MAX_SORT_THREAD_COUNT + 1];
+    for (uint64 i = 0; i <= threadCount; ++i)
+    {
+        bounds[i] = count * i / threadCount;
+    }
+
+    SortDetail::RunParallel(threadCount, [data, &bounds, &less](uint64 chunk)
+    {
+        std::sort(data + bounds[chunk], data + bounds[chunk + 1], less);
+    });
+
+    // 정렬된 구간을 두 개씩 병합 (구간 수가 단계마다 절반으로 줄어듦)
+    for (uint64 width = 1; width < threadCount; width *= 2)
+    {
+        SortDetail::RunParallel(threadCount / (width * 2), [data, &bounds, &less, width](uint64 pair)
+        {
+            const uint64 first = pair * width * 2;
+            std::inplace_merge(data + bounds[first], data + bounds[first + width],
+                               data + bounds[first + width * 2], less);
+        });
+    }
+}
+
+/// @brief 여러 스레드로 DynamicArray 정렬 (불안정 정렬)
+/// @param array 정렬할 배열
+/// @param less 비교 함수 객체 (기본값: operator<, 여러 스레드에서 동시에 호출되며 예외를 던지면 안 됨)
+template<typename T, typename Alloc, typename Compare = std::less<>>
+void ParallelSort(DynamicArray<T, Alloc>& array, Compare less = Compare())
+{
+    ParallelSort(array.GetData(), array.GetSize(), less);
+}
+
+} // namespace Excep
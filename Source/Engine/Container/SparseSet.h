@@ -0,0 +1,275 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/DynamicArray.h"
+#include "Memory/Allocator.h"
+#include <stdexcept>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 정수 인덱스를 Key로 값을 빽빽하게 저장하는 Sparse Set 컨테이너
+/// @tparam T 저장할 값의 타입
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note sparse 배열이 인덱스를 dense 위치로 매핑하고, 값은 빈틈 없는 배열에 저장됩니다.
+///       삽입/제거(마지막 값과 교체)/포함 확인은 O(1)이며 순회는 dense 배열만 훑습니다.
+///       sparse 배열은 가장 큰 인덱스 + 1 크기이므로 오브젝트 ID처럼 0부터 촘촘하게 발급되는 인덱스에 적합합니다.
+///       제거 시 마지막 값이 빈 자리로 이동하므로 값의 주소와 순회 순서는 유지되지 않습니다.
+template<typename T, typename Alloc = DefaultAllocator>
+class SparseSet
+{
+private:
+    using StorageType = DynamicArray<T, Alloc>;
+
+    static constexpr uint32 INVALID_INDEX = UINT32_MAX;
+
+public:
+    using Iterator = typename StorageType::Iterator;
+    using ConstIterator = typename StorageType::ConstIterator;
+
+    /// @brief 기본 생성자
+    SparseSet()
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit SparseSet(const Alloc& allocator)
+        : m_sparse(allocator)
+        , m_denseToIndex(allocator)
+        , m_values(allocator)
+    {
+    }
+
+    /// @brief 인덱스에 값 삽입
+    /// @param index 값의 인덱스 (UINT32_MAX 미만)
+    /// @param value 삽입할 값
+    /// @return 삽입 성공 시 true, 이미 존재하면 false
+    bool8 Insert(uint32 index, const T& value)
+    {
+        return TryEmplace(index, value) != nullptr;
+    }
+
+    /// @brief 인덱스에 값 삽입 (move semantics)
+    /// @param index 값의 인덱스 (UINT32_MAX 미만)
+    /// @param value 삽입할 값
+    /// @return 삽입 성공 시 true, 이미 존재하면 false
+    bool8 Insert(uint32 index, T&& value)
+    {
+        return TryEmplace(index, std::move(value)) != nullptr;
+    }
+
+    /// @brief 인덱스에 값이 없을 때만 제자리 생성하여 삽입
+    /// @param index 값의 인덱스 (UINT32_MAX 미만)
+    /// @param args 값 생성자 인자
+    /// @return 생성된 값의 포인터 (이미 존재하면 nullptr)
+    template<typename... Args>
+    T* TryEmplace(uint32 index, Args&&... args)
+    {
+        if (index == INVALID_INDEX)
+        {
+            throw std::out_of_range("SparseSet::Insert - index out of range");
+        }
+        if (Contains(index))
+        {
+            return nullptr;
+        }
+
+        if (index >= m_sparse.GetSize())
+        {
+            const uint32 emptySlot = INVALID_INDEX;
+            m_sparse.Resize(static_cast<uint64>(index) + 1, emptySlot);
+        }
+
+        T& value = m_values.Emplace(std::forward<Args>(args)...);
+        m_denseToIndex.Add(index);
+        m_sparse[index] = static_cast<uint32>(m_values.GetSize() - 1);
+        return &value;
+    }
+
+    /// @brief 인덱스의 값 제거
+    /// @param index 제거할 값의 인덱스
+    /// @return 제거 성공 시 true, 값이 없으면 false
+    /// @note 마지막 값이 제거된 자리로 이동합니다
+    bool8 Remove(uint32 index)
+    {
+        if (!Contains(index))
+        {
+            return false;
+        }
+
+        const uint32 denseIndex = m_sparse[index];
+        const uint32 lastIndex = static_cast<uint32>(m_values.GetSize() - 1);
+        if (denseIndex != lastIndex)
+        {
+            m_values[denseIndex] = std::move(m_values[lastIndex]);
+            m_denseToIndex[denseIndex] = m_denseToIndex[lastIndex];
+            m_sparse[m_denseToIndex[denseIndex]] = denseIndex;
+        }
+        m_values.Pop();
+        m_denseToIndex.Pop();
+        m_sparse[index] = INVALID_INDEX;
+        return true;
+    }
+
+    /// @brief 인덱스에 값이 있는지 확인
+    /// @param index 확인할 인덱스
+    /// @return 존재하면 true, 없으면 false
+    bool8 Contains(uint32 index) const
+    {
+        return index < m_sparse.GetSize() && m_sparse[index] != INVALID_INDEX;
+    }
+
+    /// @brief 인덱스로 값 찾기
+    /// @param index 찾을 인덱스
+    /// @return 값의 포인터 (없으면 nullptr)
+    T* Find(uint32 index)
+    {
+        return Contains(index) ? &m_values[m_sparse[index]] : nullptr;
+    }
+
+    /// @brief 인덱스로 값 찾기 (const 버전)
+    /// @param index 찾을 인덱스
+    /// @return 값의 const 포인터 (없으면 nullptr)
+    const T* Find(uint32 index) const
+    {
+        return Contains(index) ? &m_values[m_sparse[index]] : nullptr;
+    }
+
+    /// @brief 인덱스로 값 접근 (경계 검사, 없으면 예외)
+    /// @param index 인덱스
+    /// @return 값의 참조
+    T& GetAt(uint32 index)
+    {
+        T* value = Find(index);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("SparseSet::GetAt - index not found");
+        }
+        return *value;
+    }
+
+    /// @brief 인덱스로 값 접근 (경계 검사, 없으면 예외, const 버전)
+    /// @param index 인덱스
+    /// @return 값의 const 참조
+    const T& GetAt(uint32 index) const
+    {
+        const T* value = Find(index);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("SparseSet::GetAt - index not found");
+        }
+        return *value;
+    }
+
+    /// @brief dense 위치에 있는 값의 인덱스 반환
+    /// @param denseIndex dense 배열 위치 (GetSize() 미만)
+    /// @return 해당 값의 인덱스
+    uint32 GetIndexAt(uint64 denseIndex) const
+    {
+        return m_denseToIndex[denseIndex];
+    }
+
+    /// @brief dense 순서대로 나열된 인덱스 배열 반환
+    /// @return 첫 번째 인덱스를 가리키는 const 포인터 (GetData()와 같은 순서)
+    const uint32* GetIndices() const
+    {
+        return m_denseToIndex.GetData();
+    }
+
+    /// @brief 모든 값 제거
+    /// @note sparse 배열은 다음 삽입을 위해 크기를 유지합니다
+    void Clear()
+    {
+        for (uint64 i = 0; i < m_denseToIndex.GetSize(); ++i)
+        {
+            m_sparse[m_denseToIndex[i]] = INVALID_INDEX;
+        }
+        m_values.Clear();
+        m_denseToIndex.Clear();
+    }
+
+    /// @brief 값 용량 예약
+    /// @param capacity 예약할 값 개수
+    void Reserve(uint64 capacity)
+    {
+        m_values.Reserve(capacity);
+        m_denseToIndex.Reserve(capacity);
+    }
+
+    /// @brief 값 개수 반환
+    /// @return 값 개수
+    uint64 GetSize() const
+    {
+        return m_values.GetSize();
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_values.IsEmpty();
+    }
+
+    /// @brief dense 값 배열의 원시 데이터 포인터 반환
+    /// @return 첫 번째 값을 가리키는 포인터
+    T* GetData()
+    {
+        return m_values.GetData();
+    }
+
+    /// @brief dense 값 배열의 원시 데이터 포인터 반환 (const 버전)
+    /// @return 첫 번째 값을 가리키는 const 포인터
+    const T* GetData() const
+    {
+        return m_values.GetData();
+    }
+
+    /// @brief 시작 반복자 반환
+    /// @return 시작 반복자
+    Iterator Begin()
+    {
+        return m_values.Begin();
+    }
+
+    /// @brief 시작 반복자 반환 (const 버전)
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return m_values.Begin();
+    }
+
+    /// @brief 끝 반복자 반환
+    /// @return 끝 반복자
+    Iterator End()
+    {
+        return m_values.End();
+    }
+
+    /// @brief 끝 반복자 반환 (const 버전)
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return m_values.End();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 복사본
+    Alloc GetAllocator() const
+    {
+        return m_values.GetAllocator();
+    }
+
+    // Range-based for loop 지원
+    Iterator begin() { return m_values.Begin(); }
+    ConstIterator begin() const { return m_values.Begin(); }
+    Iterator end() { return m_values.End(); }
+    ConstIterator end() const { return m_values.End(); }
+
+private:
+    DynamicArray<uint32, Alloc> m_sparse;
+    DynamicArray<uint32, Alloc> m_denseToIndex;
+    StorageType m_values;
+};
+
+} // namespace Excep
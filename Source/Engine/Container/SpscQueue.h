@@ -0,0 +1,207 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include "Memory/Allocator.h"
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief 고정 용량의 단일 생산자/단일 소비자 링 버퍼 (wait-free)
+/// @tparam T 저장할 요소의 타입
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 정확히 하나의 스레드만 Push 계열을, 정확히 하나의 스레드만 Pop 계열을 호출해야 합니다.
+///       모든 연산은 잠금이나 재시도 없이 끝나며, 가득 차거나 비어 있으면 즉시 실패를 반환합니다.
+///       생산자/소비자 위치는 서로 다른 캐시 라인에 두고, 상대편 위치는 캐시해 두었다가
+///       필요할 때만 다시 읽어 캐시 라인 왕복을 줄입니다.
+template<typename T, typename Alloc = DefaultAllocator>
+class SpscQueue : private Alloc
+{
+public:
+    /// @brief 용량을 지정하여 생성
+    /// @param capacity 최소 용량 (2의 거듭제곱으로 올림)
+    /// @param allocator 사용할 할당자
+    explicit SpscQueue(uint64 capacity, const Alloc& allocator = Alloc())
+        : Alloc(allocator)
+        , m_capacity(NextPowerOfTwo(capacity < 2 ? 2 : capacity))
+        , m_mask(m_capacity - 1)
+        , m_tail(0)
+        , m_cachedHead(0)
+        , m_head(0)
+        , m_cachedTail(0)
+    {
+        m_buffer = static_cast<T*>(Alloc::Allocate(m_capacity * sizeof(T), alignof(T)));
+    }
+
+    ~SpscQueue()
+    {
+        const uint64 tail = m_tail.load(std::memory_order_relaxed);
+        for (uint64 i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+        {
+            m_buffer[i & m_mask].~T();
+        }
+        Alloc::Deallocate(m_buffer, m_capacity * sizeof(T), alignof(T));
+    }
+
+    // 두 스레드가 공유하는 위치를 가지므로 복사/이동 불가
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+
+    /// @brief 요소 추가 (생산자 스레드 전용)
+    /// @param value 추가할 요소
+    /// @return 성공 시 true, 가득 차 있으면 false
+    bool8 TryPush(const T& value)
+    {
+        return TryEmplace(value);
+    }
+
+    /// @brief 요소 추가 (생산자 스레드 전용, move semantics)
+    /// @param value 추가할 요소
+    /// @return 성공 시 true, 가득 차 있으면 false
+    bool8 TryPush(T&& value)
+    {
+        return TryEmplace(std::move(value));
+    }
+
+    /// @brief 요소를 제자리 생성하여 추가 (생산자 스레드 전용)
+    /// @param args 요소 생성자 인자
+    /// @return 성공 시 true, 가득 차 있으면 false
+    template<typename... Args>
+    bool8 TryEmplace(Args&&... args)
+    {
+        const uint64 tail = m_tail.load(std::memory_order_relaxed);
+        if (GetFreeCount(tail, 1) == 0)
+        {
+            return false;
+        }
+
+        new (&m_buffer[tail & m_mask]) T(std::forward<Args>(args)...);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief 여러 요소를 한 번에 추가 (생산자 스레드 전용)
+    /// @param values 추가할 요소 배열
+    /// @param count 요소 개수
+    /// @return 실제로 추가한 개수 (빈 공간이 부족하면 앞에서부터 들어간 만큼)
+    /// @note 소비자에게는 한 번의 release store로 모두 함께 공개됩니다
+    uint64 TryPushBatch(const T* values, uint64 count)
+    {
+        const uint64 tail = m_tail.load(std::memory_order_relaxed);
+        const uint64 pushCount = GetFreeCount(tail, count);
+        for (uint64 i = 0; i < pushCount; ++i)
+        {
+            new (&m_buffer[(tail + i) & m_mask]) T(values[i]);
+        }
+
+        if (pushCount > 0)
+        {
+            m_tail.store(tail + pushCount, std::memory_order_release);
+        }
+        return pushCount;
+    }
+
+    /// @brief 요소 꺼내기 (소비자 스레드 전용)
+    /// @param outValue 꺼낸 요소를 받을 변수
+    /// @return 성공 시 true, 비어 있으면 false
+    bool8 TryPop(T& outValue)
+    {
+        return TryPopBatch(&outValue, 1) == 1;
+    }
+
+    /// @brief 여러 요소를 한 번에 꺼내기 (소비자 스레드 전용)
+    /// @param outValues 꺼낸 요소를 받을 배열
+    /// @param maxCount 꺼낼 최대 개수
+    /// @return 실제로 꺼낸 개수
+    /// @note 생산자에게는 한 번의 release store로 빈 공간이 함께 반환됩니다
+    uint64 TryPopBatch(T* outValues, uint64 maxCount)
+    {
+        const uint64 head = m_head.load(std::memory_order_relaxed);
+        if (m_cachedTail - head < maxCount)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        }
+
+        const uint64 available = m_cachedTail - head;
+        const uint64 popCount = (available < maxCount) ? available : maxCount;
+        for (uint64 i = 0; i < popCount; ++i)
+        {
+            T& slot = m_buffer[(head + i) & m_mask];
+            outValues[i] = std::move(slot);
+            slot.~T();
+        }
+
+        if (popCount > 0)
+        {
+            m_head.store(head + popCount, std::memory_order_release);
+        }
+        return popCount;
+    }
+
+    /// @brief 현재 요소 개수의 근사값 반환
+    /// @return 요소 개수 (다른 스레드가 동시에 수정 중이면 호출 직후 달라질 수 있음)
+    uint64 GetSize() const
+    {
+        const uint64 head = m_head.load(std::memory_order_acquire);
+        const uint64 tail = m_tail.load(std::memory_order_acquire);
+        return (tail > head) ? tail - head : 0;
+    }
+
+    /// @brief 비어있는지 확인 (근사값)
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+    /// @brief 최대 용량 반환
+    /// @return 최대 요소 개수
+    uint64 GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return *this;
+    }
+
+private:
+    /// @brief 생산자 기준 빈 공간 개수 (requested 이하로 제한)
+    uint64 GetFreeCount(uint64 tail, uint64 requested)
+    {
+        if (m_capacity - (tail - m_cachedHead) < requested)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+
+        const uint64 freeCount = m_capacity - (tail - m_cachedHead);
+        return (freeCount < requested) ? freeCount : requested;
+    }
+
+    // 멤버 사이에 캐시 라인 크기의 패딩 배열을 넣어 서로 다른 캐시 라인에 오도록 분리
+    // (alignas를 쓰면 큐 자체가 64바이트 정렬 타입이 되어, 큐를 담는 할당자/컨테이너마다 그 정렬을 보장해야 함)
+    // 읽기 전용 (두 스레드 공유)
+    T* m_buffer;
+    const uint64 m_capacity;
+    const uint64 m_mask;
+    char8 m_padding0[CACHE_LINE_SIZE];
+
+    // 생산자 캐시 라인
+    std::atomic<uint64> m_tail;
+    uint64 m_cachedHead;
+    char8 m_padding1[CACHE_LINE_SIZE];
+
+    // 소비자 캐시 라인
+    std::atomic<uint64> m_head;
+    uint64 m_cachedTail;
+    char8 m_padding2[CACHE_LINE_SIZE];
+};
+
+} // namespace Excep
@@ -0,0 +1,441 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/BitVector.h"
+#include "Container/DynamicArray.h"
+#include "Memory/Allocator.h"
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Excep
+{
+
+/// @brief StableArray의 사용 중인 슬롯만 순회하는 전방 반복자
+/// @tparam ArrayType StableArray 타입 (const 포함)
+/// @tparam ValueType 요소 타입 (const 포함)
+template<typename ArrayType, typename ValueType>
+class StableArrayIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<ValueType>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType*;
+    using reference = ValueType&;
+
+    StableArrayIterator()
+        : m_array(nullptr)
+        , m_index(UINT64_MAX)
+    {
+    }
+
+    StableArrayIterator(ArrayType* array, uint64 index)
+        : m_array(array)
+        , m_index(index)
+    {
+    }
+
+    /// @brief 현재 요소의 인덱스 반환
+    /// @return 슬롯 인덱스
+    uint64 GetIndex() const
+    {
+        return m_index;
+    }
+
+    reference operator*() const { return (*m_array)[m_index]; }
+    pointer operator->() const { return &(*m_array)[m_index]; }
+
+    StableArrayIterator& operator++()
+    {
+        m_index = m_array->FindNextOccupied(m_index + 1);
+        return *this;
+    }
+
+    StableArrayIterator operator++(int)
+    {
+        StableArrayIterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    bool8 operator==(const StableArrayIterator& other) const { return m_index == other.m_index; }
+    bool8 operator!=(const StableArrayIterator& other) const { return m_index != other.m_index; }
+
+private:
+    ArrayType* m_array;
+    uint64 m_index;
+};
+
+/// @brief 요소를 고정 크기 청크에 저장하여 주소가 바뀌지 않는 배열 컨테이너
+/// @tparam T 저장할 요소의 타입 (복사/이동이 불가능한 타입도 Emplace로 저장 가능)
+/// @tparam ChunkSize 청크 하나의 요소 개수 (2의 거듭제곱)
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 용량이 부족하면 새 청크만 추가하고 기존 요소는 절대 이동하지 않으므로,
+///       요소의 포인터와 참조는 그 요소가 제거될 때까지 유효합니다.
+///       인덱스 접근은 O(1)이며, 제거된 슬롯은 다음 삽입에서 재사용됩니다.
+///       순회는 사용 중인 슬롯 비트를 워드 단위로 검사하여 청크 순서대로 진행합니다.
+template<typename T, uint64 ChunkSize = 64, typename Alloc = DefaultAllocator>
+class StableArray
+{
+private:
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "StableArray ChunkSize must be a power of two");
+
+public:
+    using Iterator = StableArrayIterator<StableArray, T>;
+    using ConstIterator = StableArrayIterator<const StableArray, const T>;
+
+    /// @brief 기본 생성자
+    StableArray()
+        : m_size(0)
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit StableArray(const Alloc& allocator)
+        : m_chunks(allocator)
+        , m_occupied(allocator)
+        , m_freeIndices(allocator)
+        , m_size(0)
+    {
+    }
+
+    /// @brief 복사 생성자 (각 요소는 같은 인덱스에 복사됨)
+    /// @param other 복사할 StableArray
+    StableArray(const StableArray& other)
+        : StableArray(other.GetAllocator())
+    {
+        CopyFrom(other);
+    }
+
+    /// @brief 이동 생성자 (청크 소유권만 옮기므로 요소 주소는 유지됨)
+    /// @param other 이동할 StableArray
+    StableArray(StableArray&& other) noexcept
+        : m_chunks(std::move(other.m_chunks))
+        , m_occupied(std::move(other.m_occupied))
+        , m_freeIndices(std::move(other.m_freeIndices))
+        , m_size(other.m_size)
+    {
+        other.m_chunks.Clear();
+        other.m_occupied.Clear();
+        other.m_freeIndices.Clear();
+        other.m_size = 0;
+    }
+
+    ~StableArray()
+    {
+        Clear();
+        FreeChunks();
+    }
+
+    /// @brief 복사 대입 연산자
+    /// @param other 복사할 StableArray
+    StableArray& operator=(const StableArray& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    /// @brief 이동 대입 연산자
+    /// @param other 이동할 StableArray
+    StableArray& operator=(StableArray&& other) noexcept
+    {
+        if (this != &other)
+        {
+            // 청크는 이 배열의 할당자로 해제하고, 멤버 배열과 함께 other의 할당자를 넘겨받음
+            // (other의 할당자로 할당한 청크를 나중에 같은 할당자로 해제하기 위함)
+            Clear();
+            FreeChunks();
+            m_chunks = std::move(other.m_chunks);
+            m_occupied = std::move(other.m_occupied);
+            m_freeIndices = std::move(other.m_freeIndices);
+            m_size = other.m_size;
+
+            other.m_chunks.Clear();
+            other.m_occupied.Clear();
+            other.m_freeIndices.Clear();
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    /// @brief 요소 추가 (빈 슬롯이 있으면 재사용)
+    /// @param value 추가할 요소
+    /// @return 요소가 저장된 인덱스
+    uint64 Add(const T& value)
+    {
+        return Emplace(value);
+    }
+
+    /// @brief 요소 추가 (move semantics, 빈 슬롯이 있으면 재사용)
+    /// @param value 추가할 요소
+    /// @return 요소가 저장된 인덱스
+    uint64 Add(T&& value)
+    {
+        return Emplace(std::move(value));
+    }
+
+    /// @brief 요소를 제자리 생성하여 추가 (빈 슬롯이 있으면 재사용)
+    /// @param args 요소 생성자 인자
+    /// @return 요소가 저장된 인덱스
+    template<typename... Args>
+    uint64 Emplace(Args&&... args)
+    {
+        const uint64 index = AcquireSlot();
+        try
+        {
+            new (GetSlot(index)) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_freeIndices.Add(index);
+            throw;
+        }
+
+        m_occupied.Set(index);
+        ++m_size;
+        return index;
+    }
+
+    /// @brief 인덱스의 요소 제거 (다른 요소는 이동하지 않음)
+    /// @param index 제거할 요소의 인덱스
+    /// @return 제거 성공 시 true, 비어 있는 슬롯이면 false
+    bool8 RemoveAt(uint64 index)
+    {
+        if (!IsOccupied(index))
+        {
+            return false;
+        }
+
+        GetSlot(index)->~T();
+        m_occupied.Reset(index);
+        m_freeIndices.Add(index);
+        --m_size;
+        return true;
+    }
+
+    /// @brief 인덱스에 요소가 있는지 확인
+    /// @param index 확인할 인덱스
+    /// @return 요소가 있으면 true
+    bool8 IsOccupied(uint64 index) const
+    {
+        return index < m_occupied.GetSize() && m_occupied.Test(index);
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 없음)
+    /// @param index 요소가 있는 인덱스
+    /// @return 요소의 참조
+    T& operator[](uint64 index)
+    {
+        return *GetSlot(index);
+    }
+
+    /// @brief 인덱스로 요소 접근 (경계 검사 없음, const 버전)
+    /// @param index 요소가 있는 인덱스
+    /// @return 요소의 const 참조
+    const T& operator[](uint64 index) const
+    {
+        return *GetSlot(index);
+    }
+
+    /// @brief 인덱스로 요소 접근 (비어 있는 슬롯이면 예외)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 참조
+    T& GetAt(uint64 index)
+    {
+        if (!IsOccupied(index))
+        {
+            throw std::out_of_range("StableArray::GetAt - index out of range");
+        }
+        return *GetSlot(index);
+    }
+
+    /// @brief 인덱스로 요소 접근 (비어 있는 슬롯이면 예외, const 버전)
+    /// @param index 요소의 인덱스
+    /// @return 요소의 const 참조
+    const T& GetAt(uint64 index) const
+    {
+        if (!IsOccupied(index))
+        {
+            throw std::out_of_range("StableArray::GetAt - index out of range");
+        }
+        return *GetSlot(index);
+    }
+
+    /// @brief index 이상에서 요소가 있는 첫 번째 인덱스 찾기
+    /// @param index 검색 시작 인덱스
+    /// @return 인덱스 (없으면 UINT64_MAX)
+    uint64 FindNextOccupied(uint64 index) const
+    {
+        return m_occupied.FindNextSet(index);
+    }
+
+    /// @brief 모든 요소 제거 (청크 메모리는 재사용을 위해 유지)
+    void Clear()
+    {
+        m_occupied.ForEachSetBit([this](uint64 index)
+        {
+            GetSlot(index)->~T();
+        });
+        m_occupied.Clear();
+        m_freeIndices.Clear();
+        m_size = 0;
+    }
+
+    /// @brief 요소 용량 예약 (필요한 청크를 미리 할당)
+    /// @param capacity 예약할 요소 개수
+    void Reserve(uint64 capacity)
+    {
+        while (GetCapacity() < capacity)
+        {
+            AddChunk();
+        }
+    }
+
+    /// @brief 요소 개수 반환
+    /// @return 요소 개수
+    uint64 GetSize() const
+    {
+        return m_size;
+    }
+
+    /// @brief 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /// @brief 청크에 할당된 전체 슬롯 개수 반환
+    /// @return 용량
+    uint64 GetCapacity() const
+    {
+        return m_chunks.GetSize() * ChunkSize;
+    }
+
+    /// @brief 지금까지 사용된 가장 큰 인덱스 + 1 반환
+    /// @return 인덱스 상한 (모든 요소의 인덱스는 이 값 미만)
+    uint64 GetIndexBound() const
+    {
+        return m_occupied.GetSize();
+    }
+
+    /// @brief 시작 반복자 반환
+    /// @return 시작 반복자
+    Iterator Begin()
+    {
+        return Iterator(this, FindNextOccupied(0));
+    }
+
+    /// @brief 시작 반복자 반환 (const 버전)
+    /// @return const 시작 반복자
+    ConstIterator Begin() const
+    {
+        return ConstIterator(this, FindNextOccupied(0));
+    }
+
+    /// @brief 끝 반복자 반환
+    /// @return 끝 반복자
+    Iterator End()
+    {
+        return Iterator(this, UINT64_MAX);
+    }
+
+    /// @brief 끝 반복자 반환 (const 버전)
+    /// @return const 끝 반복자
+    ConstIterator End() const
+    {
+        return ConstIterator(this, UINT64_MAX);
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 복사본
+    Alloc GetAllocator() const
+    {
+        return m_chunks.GetAllocator();
+    }
+
+    // Range-based for loop 지원
+    Iterator begin() { return Begin(); }
+    ConstIterator begin() const { return Begin(); }
+    Iterator end() { return End(); }
+    ConstIterator end() const { return End(); }
+
+private:
+    static constexpr uint64 CHUNK_MASK = ChunkSize - 1;
+
+    T* GetSlot(uint64 index) const
+    {
+        return m_chunks[index / ChunkSize] + (index & CHUNK_MASK);
+    }
+
+    /// @brief 빈 슬롯을 재사용하거나 새 슬롯을 할당 (필요하면 청크 추가)
+    uint64 AcquireSlot()
+    {
+        if (!m_freeIndices.IsEmpty())
+        {
+            const uint64 index = m_freeIndices.GetBack();
+            m_freeIndices.Pop();
+            return index;
+        }
+
+        const uint64 index = m_occupied.GetSize();
+        if (index == GetCapacity())
+        {
+            AddChunk();
+        }
+        m_occupied.Add(false);
+        return index;
+    }
+
+    void AddChunk()
+    {
+        Alloc allocator = m_chunks.GetAllocator();
+        T* chunk = static_cast<T*>(allocator.Allocate(ChunkSize * sizeof(T), alignof(T)));
+        m_chunks.Add(chunk);
+    }
+
+    void FreeChunks()
+    {
+        Alloc allocator = m_chunks.GetAllocator();
+        for (uint64 i = 0; i < m_chunks.GetSize(); ++i)
+        {
+            allocator.Deallocate(m_chunks[i], ChunkSize * sizeof(T), alignof(T));
+        }
+        m_chunks.Clear();
+    }
+
+    /// @brief other의 요소를 같은 인덱스에 복사 (this는 비어 있어야 함)
+    void CopyFrom(const StableArray& other)
+    {
+        Reserve(other.GetIndexBound());
+        m_occupied.Resize(other.GetIndexBound());
+        other.m_occupied.ForEachSetBit([this, &other](uint64 index)
+        {
+            new (GetSlot(index)) T(other[index]);
+            m_occupied.Set(index);
+            ++m_size;
+        });
+
+        for (uint64 index = 0; index < m_occupied.GetSize(); ++index)
+        {
+            if (!m_occupied.Test(index))
+            {
+                m_freeIndices.Add(index);
+            }
+        }
+    }
+
+    DynamicArray<T*, Alloc> m_chunks;
+    BitVector<Alloc> m_occupied;
+    DynamicArray<uint64, Alloc> m_freeIndices;
+    uint64 m_size;
+};
+
+} // namespace Excep
@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "Core/Types.h"
+#include "Container/StringView16.h"
+#include "Memory/Allocator.h"
 #include <string>
 #include <algorithm>
 
@@ -7,28 +9,48 @@ namespace Excep
 {
 
 /// @brief std::wstring을 래핑한 UTF-16 문자열 컨테이너
-class String16
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 일반적으로는 String16 별칭을 사용합니다
+template<typename Alloc = DefaultAllocator>
+class BasicString16
 {
+private:
+    using StorageType = std::basic_string<char16, std::char_traits<char16>, StdAllocator<char16, Alloc>>;
+
 public:
-    using Iterator = std::wstring::iterator;
-    using ConstIterator = std::wstring::const_iterator;
+    using Iterator = typename StorageType::iterator;
+    using ConstIterator = typename StorageType::const_iterator;
 
     /// @brief 기본 생성자 (빈 문자열)
-    String16()
+    BasicString16()
+    {
+    }
+
+    /// @brief 할당자를 지정하여 생성 (빈 문자열)
+    /// @param allocator 사용할 할당자
+    explicit BasicString16(const Alloc& allocator)
+        : m_data(StdAllocator<char16, Alloc>(allocator))
     {
     }
 
     /// @brief C 스타일 wide 문자열로 생성
     /// @param str C 스타일 wide 문자열
-    String16(const char16* str)
+    BasicString16(const char16* str)
         : m_data(str)
     {
     }
 
     /// @brief std::wstring으로 생성
     /// @param str std::wstring
-    String16(const std::wstring& str)
-        : m_data(str)
+    BasicString16(const std::wstring& str)
+        : m_data(str.data(), str.size())
+    {
+    }
+
+    /// @brief 문자열 뷰의 내용을 복사하여 생성
+    /// @param view 복사할 문자열 뷰
+    explicit BasicString16(StringView16 view)
+        : m_data(view.GetData(), static_cast<size_t>(view.GetLength()))
     {
     }
 
@@ -66,6 +88,14 @@ public:
         m_data.reserve(capacity);
     }
 
+    /// @brief 문자열 길이 변경 (늘어난 부분은 널 문자로 채움)
+    /// @param length 새 길이
+    /// @note 변환 등으로 결과를 직접 써 넣을 버퍼를 미리 확보할 때 사용합니다
+    void Resize(uint64 length)
+    {
+        m_data.resize(static_cast<size_t>(length));
+    }
+
     /// @brief 인덱스로 문자 접근 (경계 검사 없음)
     /// @param index 문자의 인덱스
     /// @return 문자의 참조
@@ -105,36 +135,53 @@ public:
         return m_data.c_str();
     }
 
+    /// @brief 문자열 전체를 가리키는 뷰 반환
+    /// @return 문자열 뷰 (이 문자열이 수정되거나 소멸되면 무효)
+    StringView16 GetView() const
+    {
+        return StringView16(m_data.data(), static_cast<uint64>(m_data.length()));
+    }
+
+    /// @brief 문자열 뷰로 암시적 변환 (뷰를 받는 모든 함수에 그대로 전달 가능)
+    operator StringView16() const
+    {
+        return GetView();
+    }
+
     /// @brief 문자열 끝에 추가
     /// @param str 추가할 문자열
-    void Append(const String16& str)
+    void Append(StringView16 str)
     {
-        m_data.append(str.m_data);
+        m_data.append(str.GetData(), static_cast<size_t>(str.GetLength()));
     }
 
     /// @brief 문자열 끝에 추가 (operator+=)
     /// @param str 추가할 문자열
     /// @return 자기 자신의 참조
-    String16& operator+=(const String16& str)
+    BasicString16& operator+=(StringView16 str)
     {
-        m_data += str.m_data;
+        Append(str);
         return *this;
     }
 
     /// @brief 문자열 연결 (operator+)
     /// @param str 연결할 문자열
     /// @return 연결된 새로운 문자열
-    String16 operator+(const String16& str) const
+    BasicString16 operator+(StringView16 str) const
     {
-        return String16(m_data + str.m_data);
+        BasicString16 result(GetAllocator());
+        result.m_data.reserve(m_data.length() + static_cast<size_t>(str.GetLength()));
+        result.m_data.append(m_data);
+        result.Append(str);
+        return result;
     }
 
     /// @brief 특정 위치에 문자열 삽입
     /// @param index 삽입할 위치
     /// @param str 삽입할 문자열
-    void Insert(uint64 index, const String16& str)
+    void Insert(uint64 index, StringView16 str)
     {
-        m_data.insert(index, str.m_data);
+        m_data.insert(static_cast<size_t>(index), str.GetData(), static_cast<size_t>(str.GetLength()));
     }
 
     /// @brief 특정 범위의 문자 제거
@@ -148,95 +195,79 @@ public:
     /// @brief 문자열 내에서 특정 문자열 찾기
     /// @param str 찾을 문자열
     /// @return 찾은 위치 인덱스 (없으면 UINT64_MAX)
-    uint64 Find(const String16& str) const
+    uint64 Find(StringView16 str) const
     {
-        size_t pos = m_data.find(str.m_data);
-        return (pos != std::wstring::npos) ? static_cast<uint64>(pos) : UINT64_MAX;
+        return GetView().Find(str);
     }
 
     /// @brief 문자열 내에서 주어진 문자들 중 하나가 마지막으로 등장하는 위치 찾기
     /// @param str 찾을 문자들
     /// @return 찾은 위치 인덱스 (없으면 UINT64_MAX)
-    uint64 FindLastOf(const String16& str) const
+    uint64 FindLastOf(StringView16 str) const
     {
-        size_t pos = m_data.find_last_of(str.m_data);
-        return (pos != std::wstring::npos) ? static_cast<uint64>(pos) : UINT64_MAX;
+        return GetView().FindLastOf(str);
     }
 
     /// @brief 문자열 포함 여부 확인
     /// @param str 확인할 문자열
     /// @return 포함하면 true, 아니면 false
-    bool8 Contains(const String16& str) const
+    bool8 Contains(StringView16 str) const
     {
-        return m_data.find(str.m_data) != std::wstring::npos;
+        return GetView().Contains(str);
     }
 
     /// @brief 특정 문자열로 시작하는지 확인
     /// @param str 확인할 문자열
     /// @return 시작하면 true, 아니면 false
-    bool8 StartsWith(const String16& str) const
+    bool8 StartsWith(StringView16 str) const
     {
-        return m_data.rfind(str.m_data, 0) == 0;
+        return GetView().StartsWith(str);
     }
 
     /// @brief 특정 문자열로 끝나는지 확인
     /// @param str 확인할 문자열
     /// @return 끝나면 true, 아니면 false
-    bool8 EndsWith(const String16& str) const
+    bool8 EndsWith(StringView16 str) const
     {
-        if (str.GetLength() > GetLength()) return false;
-        return m_data.compare(GetLength() - str.GetLength(), str.GetLength(), str.m_data) == 0;
+        return GetView().EndsWith(str);
     }
 
     /// @brief 부분 문자열 반환
     /// @param start 시작 인덱스
     /// @param length 길이
     /// @return 부분 문자열
-    String16 Substring(uint64 start, uint64 length) const
+    BasicString16 Substring(uint64 start, uint64 length) const
     {
-        return String16(m_data.substr(start, length));
+        BasicString16 result(GetAllocator());
+        result.m_data.assign(m_data, start, length);
+        return result;
     }
 
     /// @brief 대문자로 변환
     /// @return 대문자로 변환된 문자열
-    String16 ToUpper() const
+    BasicString16 ToUpper() const
     {
-        std::wstring result = m_data;
-        std::transform(result.begin(), result.end(), result.begin(), ::towupper);
-        return String16(result);
+        BasicString16 result(*this);
+        std::transform(result.m_data.begin(), result.m_data.end(), result.m_data.begin(), ::towupper);
+        return result;
     }
 
     /// @brief 소문자로 변환
     /// @return 소문자로 변환된 문자열
-    String16 ToLower() const
-    {
-        std::wstring result = m_data;
-        std::transform(result.begin(), result.end(), result.begin(), ::towlower);
-        return String16(result);
-    }
-
-    /// @brief 문자열 비교 (동등)
-    /// @param other 비교할 문자열
-    /// @return 같으면 true, 아니면 false
-    bool8 operator==(const String16& other) const
-    {
-        return m_data == other.m_data;
-    }
-
-    /// @brief 문자열 비교 (부등)
-    /// @param other 비교할 문자열
-    /// @return 다르면 true, 아니면 false
-    bool8 operator!=(const String16& other) const
+    BasicString16 ToLower() const
     {
-        return m_data != other.m_data;
+        BasicString16 result(*this);
+        std::transform(result.m_data.begin(), result.m_data.end(), result.m_data.begin(), ::towlower);
+        return result;
     }
 
     /// @brief 문자열 사전순 비교
     /// @param other 비교할 문자열
     /// @return 음수: this < other, 0: 같음, 양수: this > other
-    int32 Compare(const String16& other) const
+    /// @note ==, !=, < 등의 비교 연산자는 StringView16.h에 정의되어 있습니다
+    int32 Compare(StringView16 other) const
     {
-        return static_cast<int32>(m_data.compare(other.m_data));
+        return GetView().Compare(other);
     }
 
     /// @brief 문자열의 시작 반복자 반환
@@ -267,6 +298,13 @@ public:
         return m_data.end();
     }
 
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 복사본
+    Alloc GetAllocator() const
+    {
+        return m_data.get_allocator().GetAllocator();
+    }
+
     // Range-based for loop 지원
     Iterator begin() { return m_data.begin(); }
     ConstIterator begin() const { return m_data.begin(); }
@@ -274,7 +312,16 @@ public:
     ConstIterator end() const { return m_data.end(); }
 
 private:
-    std::wstring m_data;
+    StorageType m_data;
+};
+
+/// @brief 기본 할당자를 사용하는 UTF-16 문자열
+using String16 = BasicString16<>;
+
+/// @brief StringView16과 같은 해시를 사용하므로 String16 Key 컨테이너를 뷰로 조회할 수 있음
+template<typename Alloc>
+struct Hash<BasicString16<Alloc>> : Hash<StringView16>
+{
 };
 
 } // namespace Excep
@@ -0,0 +1,471 @@
+﻿#include "Core/Pch.h"
+#include "Container/StringConversion.h"
+#include "Core/Intrinsics.h"
+
+namespace Excep
+{
+
+namespace
+{
+
+static_assert(sizeof(char16) == 2, "String16은 UTF-16 코드 유닛을 저장해야 합니다");
+
+constexpr uint32 REPLACEMENT_CHARACTER = 0xFFFD;
+
+/// @brief UTF-8 연속 바이트(10xxxxxx)인지 확인
+inline bool8 IsContinuation(uint8 byte)
+{
+    return (byte & 0xC0) == 0x80;
+}
+
+/// @brief UTF-8 시퀀스 하나를 코드 포인트로 디코딩
+/// @param src 시퀀스 시작 위치
+/// @param remaining 남은 바이트 수 (1 이상)
+/// @param outCodePoint 디코딩된 코드 포인트
+/// @return 소비한 바이트 수 (잘못된 시퀀스면 0)
+uint64 DecodeUtf8Sequence(const uint8* src, uint64 remaining, uint32& outCodePoint)
+{
+    const uint32 lead = src[0];
+    if (lead < 0x80)
+    {
+        outCodePoint = lead;
+        return 1;
+    }
+
+    // 0x80~0xC1: 단독 연속 바이트 또는 overlong 2바이트 시퀀스
+    if (lead < 0xC2)
+    {
+        return 0;
+    }
+
+    if (lead < 0xE0)
+    {
+        if (remaining < 2 || !IsContinuation(src[1]))
+        {
+            return 0;
+        }
+        outCodePoint = ((lead & 0x1F) << 6) | (src[1] & 0x3Fu);
+        return 2;
+    }
+
+    if (lead < 0xF0)
+    {
+        if (remaining < 3 || !IsContinuation(src[1]) || !IsContinuation(src[2]))
+        {
+            return 0;
+        }
+        // E0: overlong, ED: 서로게이트 범위(U+D800~U+DFFF)
+        if ((lead == 0xE0 && src[1] < 0xA0) || (lead == 0xED && src[1] > 0x9F))
+        {
+            return 0;
+        }
+        outCodePoint = ((lead & 0x0F) << 12) | ((src[1] & 0x3Fu) << 6) | (src[2] & 0x3Fu);
+        return 3;
+    }
+
+    if (lead < 0xF5)
+    {
+        if (remaining < 4 || !IsContinuation(src[1]) || !IsContinuation(src[2]) || !IsContinuation(src[3]))
+        {
+            return 0;
+        }
+        // F0: overlong, F4: U+10FFFF 초과
+        if ((lead == 0xF0 && src[1] < 0x90) || (lead == 0xF4 && src[1] > 0x8F))
+        {
+            return 0;
+        }
+        outCodePoint = ((lead & 0x07) << 18) | ((src[1] & 0x3Fu) << 12) | ((src[2] & 0x3Fu) << 6) | (src[3] & 0x3Fu);
+        return 4;
+    }
+
+    return 0;
+}
+
+/// @brief UTF-16 코드 유닛 하나 또는 서로게이트 쌍을 코드 포인트로 디코딩
+/// @param src 시퀀스 시작 위치
+/// @param remaining 남은 코드 유닛 수 (1 이상)
+/// @param outCodePoint 디코딩된 코드 포인트
+/// @return 소비한 코드 유닛 수 (짝이 맞지 않는 서로게이트면 0)
+uint64 DecodeUtf16Sequence(const char16* src, uint64 remaining, uint32& outCodePoint)
+{
+    const uint32 unit = static_cast<uint16>(src[0]);
+    if (unit < 0xD800 || unit > 0xDFFF)
+    {
+        outCodePoint = unit;
+        return 1;
+    }
+
+    if (unit <= 0xDBFF && remaining >= 2)
+    {
+        const uint32 low = static_cast<uint16>(src[1]);
+        if (low >= 0xDC00 && low <= 0xDFFF)
+        {
+            outCodePoint = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+            return 2;
+        }
+    }
+
+    return 0;
+}
+
+/// @brief 코드 포인트를 UTF-16으로 기록
+/// @return 기록한 코드 유닛 수
+inline uint64 EncodeUtf16(uint32 codePoint, char16* dst)
+{
+    if (codePoint < 0x10000)
+    {
+        dst[0] = static_cast<char16>(codePoint);
+        return 1;
+    }
+
+    codePoint -= 0x10000;
+    dst[0] = static_cast<char16>(0xD800 + (codePoint >> 10));
+    dst[1] = static_cast<char16>(0xDC00 + (codePoint & 0x3FF));
+    return 2;
+}
+
+/// @brief 코드 포인트의 UTF-8 바이트 수
+inline uint64 GetUtf8Length(uint32 codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        return 1;
+    }
+    if (codePoint < 0x800)
+    {
+        return 2;
+    }
+    return (codePoint < 0x10000) ? 3 : 4;
+}
+
+/// @brief 코드 포인트를 UTF-8로 기록
+/// @return 기록한 바이트 수
+inline uint64 EncodeUtf8(uint32 codePoint, uint8* dst)
+{
+    if (codePoint < 0x80)
+    {
+        dst[0] = static_cast<uint8>(codePoint);
+        return 1;
+    }
+    if (codePoint < 0x800)
+    {
+        dst[0] = static_cast<uint8>(0xC0 | (codePoint >> 6));
+        dst[1] = static_cast<uint8>(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint < 0x10000)
+    {
+        dst[0] = static_cast<uint8>(0xE0 | (codePoint >> 12));
+        dst[1] = static_cast<uint8>(0x80 | ((codePoint >> 6) & 0x3F));
+        dst[2] = static_cast<uint8>(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    dst[0] = static_cast<uint8>(0xF0 | (codePoint >> 18));
+    dst[1] = static_cast<uint8>(0x80 | ((codePoint >> 12) & 0x3F));
+    dst[2] = static_cast<uint8>(0x80 | ((codePoint >> 6) & 0x3F));
+    dst[3] = static_cast<uint8>(0x80 | (codePoint & 0x3F));
+    return 4;
+}
+
+#if EXCEP_SIMD_SSE2
+/// @brief 16개의 UTF-16 코드 유닛이 모두 ASCII인지 검사
+inline bool8 IsAsciiBlock(__m128i low, __m128i high)
+{
+    // 0x7F보다 큰 유닛은 상위 9비트 중 하나가 1
+    const __m128i nonAsciiBits = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi16(static_cast<int16>(0xFF80)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(nonAsciiBits, _mm_setzero_si128())) == 0xFFFF;
+}
+
+/// @brief 16개의 UTF-16 코드 유닛 중 ASCII가 아닌 유닛의 비트 마스크 반환
+/// @return i번째 유닛이 0x7F보다 크면 i번째 비트가 1 (모두 ASCII면 0)
+inline uint32 GetNonAsciiMask(__m128i low, __m128i high)
+{
+    // 0x7F보다 큰 유닛은 상위 9비트 중 하나가 1
+    const __m128i highBits = _mm_set1_epi16(static_cast<int16>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i asciiLow = _mm_cmpeq_epi16(_mm_and_si128(low, highBits), zero);
+    const __m128i asciiHigh = _mm_cmpeq_epi16(_mm_and_si128(high, highBits), zero);
+    // 유닛별 비교 결과(0 또는 -1)를 부호 포화 pack으로 바이트 하나씩에 모음
+    const uint32 asciiMask = static_cast<uint32>(_mm_movemask_epi8(_mm_packs_epi16(asciiLow, asciiHigh)));
+    return ~asciiMask & 0xFFFF;
+}
+#endif
+
+/// @brief UTF-8을 UTF-16으로 변환 (잘못된 바이트는 U+FFFD로 대체)
+/// @param str 입력 UTF-8
+/// @param length 입력 바이트 수
+/// @param dst 출력 버퍼 (length개 이상의 코드 유닛 공간 필요)
+/// @param outValid 입력이 올바른 UTF-8이었는지 여부
+/// @return 기록한 코드 유닛 수
+/// @tparam USE_SIMD SSE2 ASCII 블록 경로 사용 여부 (false는 벤치마크 비교용 스칼라 경로)
+template<bool8 USE_SIMD>
+uint64 ConvertUtf8ToUtf16(const char8* str, uint64 length, char16* dst, bool8& outValid)
+{
+    const uint8* src = reinterpret_cast<const uint8*>(str);
+    uint64 read = 0;
+    uint64 written = 0;
+    outValid = true;
+
+    while (read < length)
+    {
+        // SIMD 검사에 실패한 블록은 마지막 비 ASCII 위치까지 스칼라로 처리해 같은 위치를 다시 검사하지 않음
+        uint64 scalarEnd = read;
+#if EXCEP_SIMD_SSE2
+        // ASCII만 있는 16바이트 블록은 0과 interleave하여 한 번에 16비트로 확장
+        if (USE_SIMD && length - read >= 16)
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + read));
+            const uint32 nonAsciiMask = static_cast<uint32>(_mm_movemask_epi8(bytes));
+            if (nonAsciiMask == 0)
+            {
+                const __m128i zero = _mm_setzero_si128();
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + written), _mm_unpacklo_epi8(bytes, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + written + 8), _mm_unpackhi_epi8(bytes, zero));
+                read += 16;
+                written += 16;
+                continue;
+            }
+
+            scalarEnd = read + 32 - CountLeadingZeros32(nonAsciiMask);
+
+            // 첫 번째 비 ASCII 바이트 앞까지는 그대로 복사
+            const uint32 asciiCount = CountTrailingZeros32(nonAsciiMask);
+            for (uint32 i = 0; i < asciiCount; ++i)
+            {
+                dst[written + i] = static_cast<char16>(src[read + i]);
+            }
+            read += asciiCount;
+            written += asciiCount;
+        }
+#endif
+
+        // 블록의 마지막 비 ASCII 바이트까지 디코딩하고, 이어지는 비 ASCII 구간은 다음 ASCII 바이트가 나올 때까지 계속
+        do
+        {
+            // 블록 안에 섞인 ASCII 바이트는 디코딩 없이 바로 복사
+            if (src[read] < 0x80)
+            {
+                dst[written++] = static_cast<char16>(src[read++]);
+                continue;
+            }
+
+            uint32 codePoint;
+            uint64 consumed = DecodeUtf8Sequence(src + read, length - read, codePoint);
+            if (consumed == 0)
+            {
+                outValid = false;
+                codePoint = REPLACEMENT_CHARACTER;
+                consumed = 1;
+            }
+            written += EncodeUtf16(codePoint, dst + written);
+            read += consumed;
+        } while (read < length && (read < scalarEnd || src[read] >= 0x80));
+    }
+
+    return written;
+}
+
+/// @brief UTF-16을 UTF-8로 변환했을 때의 바이트 수 계산
+/// @param src 입력 UTF-16
+/// @param length 입력 코드 유닛 수
+/// @param outValid 입력이 올바른 UTF-16이었는지 여부
+/// @return 필요한 바이트 수 (잘못된 서로게이트는 U+FFFD 3바이트로 계산)
+/// @tparam USE_SIMD SSE2 ASCII 블록 경로 사용 여부
+template<bool8 USE_SIMD>
+uint64 MeasureUtf16ToUtf8(const char16* src, uint64 length, bool8& outValid)
+{
+    uint64 read = 0;
+    uint64 required = 0;
+    outValid = true;
+
+    while (read < length)
+    {
+        // SIMD 검사에 실패한 블록은 마지막 비 ASCII 위치까지 스칼라로 처리해 같은 위치를 다시 검사하지 않음
+        uint64 scalarEnd = read;
+#if EXCEP_SIMD_SSE2
+        if (USE_SIMD && length - read >= 16)
+        {
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + read));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + read + 8));
+            if (IsAsciiBlock(low, high))
+            {
+                read += 16;
+                required += 16;
+                continue;
+            }
+            scalarEnd = read + 32 - CountLeadingZeros32(GetNonAsciiMask(low, high));
+        }
+#endif
+
+        do
+        {
+            if (static_cast<uint16>(src[read]) < 0x80)
+            {
+                ++read;
+                ++required;
+                continue;
+            }
+
+            uint32 codePoint;
+            uint64 consumed = DecodeUtf16Sequence(src + read, length - read, codePoint);
+            if (consumed == 0)
+            {
+                outValid = false;
+                codePoint = REPLACEMENT_CHARACTER;
+                consumed = 1;
+            }
+            required += GetUtf8Length(codePoint);
+            read += consumed;
+        } while (read < length && (read < scalarEnd || static_cast<uint16>(src[read]) >= 0x80));
+    }
+
+    return required;
+}
+
+/// @brief UTF-16을 UTF-8로 변환 (짝이 맞지 않는 서로게이트는 U+FFFD로 대체)
+/// @param src 입력 UTF-16
+/// @param length 입력 코드 유닛 수
+/// @param str 출력 버퍼 (MeasureUtf16ToUtf8이 반환한 크기 이상)
+/// @tparam USE_SIMD SSE2 ASCII 블록 경로 사용 여부
+template<bool8 USE_SIMD>
+void ConvertUtf16ToUtf8(const char16* src, uint64 length, char8* str)
+{
+    uint8* dst = reinterpret_cast<uint8*>(str);
+    uint64 read = 0;
+    uint64 written = 0;
+
+    while (read < length)
+    {
+        // SIMD 검사에 실패한 블록은 마지막 비 ASCII 위치까지 스칼라로 처리해 같은 위치를 다시 검사하지 않음
+        uint64 scalarEnd = read;
+#if EXCEP_SIMD_SSE2
+        // ASCII만 있는 16유닛 블록은 포화 pack으로 한 번에 8비트로 축소
+        if (USE_SIMD && length - read >= 16)
+        {
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + read));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + read + 8));
+            if (IsAsciiBlock(low, high))
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + written), _mm_packus_epi16(low, high));
+                read += 16;
+                written += 16;
+                continue;
+            }
+            scalarEnd = read + 32 - CountLeadingZeros32(GetNonAsciiMask(low, high));
+        }
+#endif
+
+        do
+        {
+            if (static_cast<uint16>(src[read]) < 0x80)
+            {
+                dst[written++] = static_cast<uint8>(src[read++]);
+                continue;
+            }
+
+            uint32 codePoint;
+            uint64 consumed = DecodeUtf16Sequence(src + read, length - read, codePoint);
+            if (consumed == 0)
+            {
+                codePoint = REPLACEMENT_CHARACTER;
+                consumed = 1;
+            }
+            written += EncodeUtf8(codePoint, dst + written);
+            read += consumed;
+        } while (read < length && (read < scalarEnd || static_cast<uint16>(src[read]) >= 0x80));
+    }
+}
+
+template<bool8 USE_SIMD>
+void Utf8ToUtf16(StringView8 str, String16& outResult, bool8& outValid)
+{
+    outValid = true;
+    outResult.Clear();
+    if (str.IsEmpty())
+    {
+        return;
+    }
+
+    // UTF-16 코드 유닛 수는 UTF-8 바이트 수를 넘지 않음
+    outResult.Resize(str.GetLength());
+    const uint64 written = ConvertUtf8ToUtf16<USE_SIMD>(str.GetData(), str.GetLength(), &outResult[0], outValid);
+    outResult.Resize(written);
+}
+
+template<bool8 USE_SIMD>
+void Utf16ToUtf8(StringView16 str, String8& outResult, bool8& outValid)
+{
+    outValid = true;
+    outResult.Clear();
+    if (str.IsEmpty())
+    {
+        return;
+    }
+
+    // 최대 3배로 잡지 않고 정확한 크기를 먼저 계산하여 큰 텍스트에서도 한 번만 할당
+    outResult.Resize(MeasureUtf16ToUtf8<USE_SIMD>(str.GetData(), str.GetLength(), outValid));
+    ConvertUtf16ToUtf8<USE_SIMD>(str.GetData(), str.GetLength(), &outResult[0]);
+}
+
+} // namespace
+
+String16 ToString16(StringView8 str)
+{
+    String16 result;
+    bool8 valid;
+    Utf8ToUtf16<true>(str, result, valid);
+    return result;
+}
+
+String8 ToString8(StringView16 str)
+{
+    String8 result;
+    bool8 valid;
+    Utf16ToUtf8<true>(str, result, valid);
+    return result;
+}
+
+bool8 TryToString16(StringView8 str, String16& outResult)
+{
+    bool8 valid;
+    Utf8ToUtf16<true>(str, outResult, valid);
+    if (!valid)
+    {
+        outResult.Clear();
+    }
+    return valid;
+}
+
+bool8 TryToString8(StringView16 str, String8& outResult)
+{
+    bool8 valid;
+    Utf16ToUtf8<true>(str, outResult, valid);
+    if (!valid)
+    {
+        outResult.Clear();
+    }
+    return valid;
+}
+
+namespace StringConversionDetail
+{
+
+String16 ToString16Scalar(StringView8 str)
+{
+    String16 result;
+    bool8 valid;
+    Utf8ToUtf16<false>(str, result, valid);
+    return result;
+}
+
+String8 ToString8Scalar(StringView16 str)
+{
+    String8 result;
+    bool8 valid;
+    Utf16ToUtf8<false>(str, result, valid);
+    return result;
+}
+
+} // namespace StringConversionDetail
+
+} // namespace Excep
@@ -0,0 +1,47 @@
+﻿#pragma once
+#include "Core/ExcepAPI.h"
+#include "Container/String8.h"
+#include "Container/String16.h"
+
+namespace Excep
+{
+
+/// @brief UTF-8 문자열을 UTF-16 문자열로 변환
+/// @param str 변환할 UTF-8 문자열
+/// @return 변환된 UTF-16 문자열
+/// @note 잘못된 UTF-8 바이트(잘린 시퀀스, overlong, 서로게이트 범위, U+10FFFF 초과)는
+///       바이트마다 U+FFFD로 대체합니다. ASCII 구간은 SSE2로 16바이트씩 변환합니다.
+EXCEP_API String16 ToString16(StringView8 str);
+
+/// @brief UTF-16 문자열을 UTF-8 문자열로 변환
+/// @param str 변환할 UTF-16 문자열
+/// @return 변환된 UTF-8 문자열
+/// @note 짝이 맞지 않는 서로게이트는 U+FFFD로 대체합니다. ASCII 구간은 SSE2로 16문자씩 변환합니다.
+EXCEP_API String8 ToString8(StringView16 str);
+
+/// @brief UTF-8 문자열을 검증하면서 UTF-16 문자열로 변환
+/// @param str 변환할 UTF-8 문자열
+/// @param outResult 변환 결과 (실패 시 빈 문자열)
+/// @return 올바른 UTF-8이면 true, 아니면 false
+EXCEP_API bool8 TryToString16(StringView8 str, String16& outResult);
+
+/// @brief UTF-16 문자열을 검증하면서 UTF-8 문자열로 변환
+/// @param str 변환할 UTF-16 문자열
+/// @param outResult 변환 결과 (실패 시 빈 문자열)
+/// @return 올바른 UTF-16이면 true, 아니면 false
+EXCEP_API bool8 TryToString8(StringView16 str, String8& outResult);
+
+namespace StringConversionDetail
+{
+
+/// @brief SSE2 ASCII 블록 경로 없이 스칼라 경로로만 UTF-8 → UTF-16 변환 (결과는 ToString16과 같음)
+/// @note 벤치마크에서 SIMD 경로의 속도 향상을 비교하기 위한 기준이며, 일반 코드는 ToString16을 사용합니다
+EXCEP_API String16 ToString16Scalar(StringView8 str);
+
+/// @brief SSE2 ASCII 블록 경로 없이 스칼라 경로로만 UTF-16 → UTF-8 변환 (결과는 ToString8과 같음)
+/// @note 벤치마크에서 SIMD 경로의 속도 향상을 비교하기 위한 기준이며, 일반 코드는 ToString8을 사용합니다
+EXCEP_API String8 ToString8Scalar(StringView16 str);
+
+} // namespace StringConversionDetail
+
+} // namespace Excep
@@ -0,0 +1,313 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Container/Hash.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace Excep
+{
+
+/// @brief UTF-16 문자열의 일부를 가리키는 소유하지 않는 뷰
+/// @note 메모리를 할당하지 않으며, 가리키는 문자열보다 오래 사용하면 안 됩니다.
+///       null 종료가 보장되지 않으므로 C API에는 String16로 변환하여 전달합니다.
+class StringView16
+{
+private:
+    using Traits = std::char_traits<char16>;
+
+public:
+    using ConstIterator = const char16*;
+
+    /// @brief 기본 생성자 (빈 뷰)
+    StringView16()
+        : m_data(L"")
+        , m_length(0)
+    {
+    }
+
+    /// @brief C 스타일 문자열로 생성
+    /// @param str null 종료 문자열
+    StringView16(const char16* str)
+        : m_data(str)
+        , m_length(static_cast<uint64>(Traits::length(str)))
+    {
+    }
+
+    /// @brief 포인터와 길이로 생성
+    /// @param str 문자열 시작 포인터
+    /// @param length 문자 개수
+    StringView16(const char16* str, uint64 length)
+        : m_data(str)
+        , m_length(length)
+    {
+    }
+
+    /// @brief 문자열 길이 반환
+    /// @return 문자열 길이 (문자 개수)
+    uint64 GetLength() const
+    {
+        return m_length;
+    }
+
+    /// @brief 문자열 크기 반환 (GetLength와 동일)
+    /// @return 문자열 크기
+    uint64 GetSize() const
+    {
+        return m_length;
+    }
+
+    /// @brief 뷰가 비어있는지 확인
+    /// @return 비어있으면 true, 아니면 false
+    bool8 IsEmpty() const
+    {
+        return m_length == 0;
+    }
+
+    /// @brief 원시 데이터 포인터 반환 (null 종료 보장 없음)
+    /// @return 첫 번째 문자를 가리키는 포인터
+    const char16* GetData() const
+    {
+        return m_data;
+    }
+
+    /// @brief 인덱스로 문자 접근 (경계 검사 없음)
+    /// @param index 문자의 인덱스
+    /// @return 문자의 const 참조
+    const char16& operator[](uint64 index) const
+    {
+        return m_data[index];
+    }
+
+    /// @brief 문자열 내에서 특정 문자열 찾기
+    /// @param str 찾을 문자열
+    /// @param start 검색 시작 위치
+    /// @return 찾은 위치 인덱스 (없으면 UINT64_MAX)
+    uint64 Find(StringView16 str, uint64 start = 0) const
+    {
+        if (start > m_length)
+        {
+            return UINT64_MAX;
+        }
+
+        const char16* end = m_data + m_length;
+        const char16* found = std::search(m_data + start, end, str.m_data, str.m_data + str.m_length);
+        if (found == end && str.m_length != 0)
+        {
+            return UINT64_MAX;
+        }
+        return static_cast<uint64>(found - m_data);
+    }
+
+    /// @brief 문자열 내에서 특정 문자 찾기
+    /// @param ch 찾을 문자
+    /// @param start 검색 시작 위치
+    /// @return 찾은 위치 인덱스 (없으면 UINT64_MAX)
+    uint64 Find(char16 ch, uint64 start = 0) const
+    {
+        if (start >= m_length)
+        {
+            return UINT64_MAX;
+        }
+
+        const char16* found = Traits::find(m_data + start, static_cast<size_t>(m_length - start), ch);
+        return (found != nullptr) ? static_cast<uint64>(found - m_data) : UINT64_MAX;
+    }
+
+    /// @brief 문자열 내에서 특정 문자열이 마지막으로 등장하는 위치 찾기
+    /// @param str 찾을 문자열
+    /// @return 찾은 위치 인덱스 (없으면 UINT64_MAX)
+    uint64 FindLast(StringView16 str) const
+    {
+        if (str.m_length > m_length)
+        {
+            return UINT64_MAX;
+        }
+
+        const char16* end = m_data + m_length;
+        const char16* found = std::find_end(m_data, end, str.m_data, str.m_data + str.m_length);
+        if (found == end && str.m_length != 0)
+        {
+            return UINT64_MAX;
+        }
+        return static_cast<uint64>(found - m_data);
+    }
+
+    /// @brief 주어진 문자들 중 하나가 처음 등장하는 위치 찾기
+    /// @param chars 찾을 문자들
+    /// @return 찾은 위치 인덱스 (없으면 UINT64_MAX)
+    uint64 FindFirstOf(StringView16 chars) const
+    {
+        for (uint64 i = 0; i < m_length; ++i)
+        {
+            if (Traits::find(chars.m_data, static_cast<size_t>(chars.m_length), m_data[i]) != nullptr)
+            {
+                return i;
+            }
+        }
+        return UINT64_MAX;
+    }
+
+    /// @brief 주어진 문자들 중 하나가 마지막으로 등장하는 위치 찾기
+    /// @param chars 찾을 문자들
+    /// @return 찾은 위치 인덱스 (없으면 UINT64_MAX)
+    uint64 FindLastOf(StringView16 chars) const
+    {
+        for (uint64 i = m_length; i > 0; --i)
+        {
+            if (Traits::find(chars.m_data, static_cast<size_t>(chars.m_length), m_data[i - 1]) != nullptr)
+            {
+                return i - 1;
+            }
+        }
+        return UINT64_MAX;
+    }
+
+    /// @brief 문자열 포함 여부 확인
+    /// @param str 확인할 문자열
+    /// @return 포함하면 true, 아니면 false
+    bool8 Contains(StringView16 str) const
+    {
+        return Find(str) != UINT64_MAX;
+    }
+
+    /// @brief 특정 문자열로 시작하는지 확인
+    /// @param str 확인할 문자열
+    /// @return 시작하면 true, 아니면 false
+    bool8 StartsWith(StringView16 str) const
+    {
+        if (str.m_length > m_length)
+        {
+            return false;
+        }
+        return Traits::compare(m_data, str.m_data, static_cast<size_t>(str.m_length)) == 0;
+    }
+
+    /// @brief 특정 문자열로 끝나는지 확인
+    /// @param str 확인할 문자열
+    /// @return 끝나면 true, 아니면 false
+    bool8 EndsWith(StringView16 str) const
+    {
+        if (str.m_length > m_length)
+        {
+            return false;
+        }
+        const char16* suffix = m_data + (m_length - str.m_length);
+        return Traits::compare(suffix, str.m_data, static_cast<size_t>(str.m_length)) == 0;
+    }
+
+    /// @brief 부분 문자열 뷰 반환 (할당 없음)
+    /// @param start 시작 인덱스
+    /// @param length 길이 (남은 길이보다 길면 끝까지)
+    /// @return 부분 문자열 뷰
+    StringView16 Substring(uint64 start, uint64 length = UINT64_MAX) const
+    {
+        if (start > m_length)
+        {
+            throw std::out_of_range("StringView16::Substring - start out of range");
+        }
+
+        const uint64 remaining = m_length - start;
+        return StringView16(m_data + start, (length < remaining) ? length : remaining);
+    }
+
+    /// @brief 앞쪽 문자들을 뷰에서 제외
+    /// @param count 제외할 문자 개수 (GetLength() 이하)
+    void RemovePrefix(uint64 count)
+    {
+        m_data += count;
+        m_length -= count;
+    }
+
+    /// @brief 뒤쪽 문자들을 뷰에서 제외
+    /// @param count 제외할 문자 개수 (GetLength() 이하)
+    void RemoveSuffix(uint64 count)
+    {
+        m_length -= count;
+    }
+
+    /// @brief 문자열 사전순 비교
+    /// @param other 비교할 문자열
+    /// @return 음수: this < other, 0: 같음, 양수: this > other
+    int32 Compare(StringView16 other) const
+    {
+        const uint64 length = (m_length < other.m_length) ? m_length : other.m_length;
+        int32 result = Traits::compare(m_data, other.m_data, static_cast<size_t>(length));
+        if (result != 0)
+        {
+            return result;
+        }
+        if (m_length == other.m_length)
+        {
+            return 0;
+        }
+        return (m_length < other.m_length) ? -1 : 1;
+    }
+
+    /// @brief 뷰의 시작 반복자 반환
+    /// @return 시작 반복자
+    ConstIterator Begin() const
+    {
+        return m_data;
+    }
+
+    /// @brief 뷰의 끝 반복자 반환
+    /// @return 끝 반복자
+    ConstIterator End() const
+    {
+        return m_data + m_length;
+    }
+
+    // Range-based for loop 지원
+    ConstIterator begin() const { return m_data; }
+    ConstIterator end() const { return m_data + m_length; }
+
+private:
+    const char16* m_data;
+    uint64 m_length;
+};
+
+// String16과 C 문자열도 StringView16로 변환되어 같은 비교 연산자를 사용합니다
+inline bool8 operator==(StringView16 lhs, StringView16 rhs)
+{
+    return lhs.GetLength() == rhs.GetLength() && lhs.Compare(rhs) == 0;
+}
+
+inline bool8 operator!=(StringView16 lhs, StringView16 rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bool8 operator<(StringView16 lhs, StringView16 rhs)
+{
+    return lhs.Compare(rhs) < 0;
+}
+
+inline bool8 operator>(StringView16 lhs, StringView16 rhs)
+{
+    return lhs.Compare(rhs) > 0;
+}
+
+inline bool8 operator<=(StringView16 lhs, StringView16 rhs)
+{
+    return lhs.Compare(rhs) <= 0;
+}
+
+inline bool8 operator>=(StringView16 lhs, StringView16 rhs)
+{
+    return lhs.Compare(rhs) >= 0;
+}
+
+/// @brief 문자열 내용을 해시 (String16, 문자열 리터럴도 같은 값을 내므로 is_transparent)
+template<>
+struct Hash<StringView16>
+{
+    using is_transparent = void;
+
+    uint64 operator()(StringView16 value) const
+    {
+        return HashBytes(value.GetData(), value.GetLength() * sizeof(char16));
+    }
+};
+
+} // namespace Excep
@@ -1,22 +1,38 @@
 ﻿#pragma once
 #include "Core/Types.h"
-#include "Container/DynamicArray.h"
-#include <map>
+#include "Container/BPlusTree.h"
+#include "Container/IteratorRange.h"
+#include "Memory/Allocator.h"
+#include <functional>
 #include <initializer_list>
+#include <stdexcept>
 #include <utility>
 
 namespace Excep
 {
 
-/// @brief std::map을 래핑한 정렬된 Key-Value 맵 컨테이너
+/// @brief B+트리 기반의 정렬된 Key-Value 맵 컨테이너
 /// @tparam K Key 타입
 /// @tparam V Value 타입
-template<typename K, typename V>
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note Key와 Value는 노드마다 별도의 연속 배열에 저장되므로 반복자는 (const K&, V&) 참조 쌍을 값으로 반환합니다.
+///       range-based for에서는 `for (const auto& pair : map)` 또는 `for (auto pair : map)` 형태로 사용합니다.
+///       삽입/삭제 시 기존 포인터와 반복자는 모두 무효화됩니다.
+///       Find/Contains/Remove/LowerBound/UpperBound는 K와 < 비교가 되는 다른 타입(StringView8 등)을
+///       그대로 받으므로 조회를 위해 임시 Key를 만들지 않습니다.
+template<typename K, typename V, typename Alloc = DefaultAllocator>
 class TreeMap
 {
+private:
+    // std::less<>는 is_transparent이므로 K가 아닌 타입으로도 조회 가능
+    using StorageType = BPlusTree<K, V, std::less<>, Alloc>;
+
 public:
-    using Iterator = typename std::map<K, V>::iterator;
-    using ConstIterator = typename std::map<K, V>::const_iterator;
+    using Iterator = typename StorageType::Iterator;
+    using ConstIterator = typename StorageType::ConstIterator;
+    using KeyIterator = ProjectionIterator<ConstIterator, PairFirst>;
+    using ValueIterator = ProjectionIterator<Iterator, PairSecond>;
+    using ConstValueIterator = ProjectionIterator<ConstIterator, PairSecond>;
     using Pair = std::pair<K, V>;
 
     /// @brief 기본 생성자
@@ -24,11 +40,21 @@ public:
     {
     }
 
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit TreeMap(const Alloc& allocator)
+        : m_data(allocator)
+    {
+    }
+
     /// @brief 초기화 리스트로 생성
     /// @param initList 초기화 리스트
     TreeMap(std::initializer_list<Pair> initList)
-        : m_data(initList)
     {
+        for (const auto& pair : initList)
+        {
+            m_data.TryEmplace(pair.first, pair.second);
+        }
     }
 
     /// @brief Key-Value 쌍 삽입
@@ -37,25 +63,26 @@ public:
     /// @return 삽입 성공 시 true, 이미 존재하면 false
     bool8 Insert(const K& key, const V& value)
     {
-        auto result = m_data.insert({key, value});
-        return result.second;
+        return m_data.TryEmplace(key, value).second;
     }
 
     /// @brief Key로 요소 제거
-    /// @param key 제거할 키
+    /// @param key 제거할 키 (K 또는 K와 비교 가능한 타입)
     /// @return 제거 성공 시 true, 키가 없으면 false
-    bool8 Remove(const K& key)
+    template<typename Q>
+    bool8 Remove(const Q& key)
     {
-        return m_data.erase(key) > 0;
+        return m_data.Remove(key);
     }
 
     /// @brief Key로 Value 찾기
-    /// @param key 찾을 키
+    /// @param key 찾을 키 (K 또는 K와 비교 가능한 타입)
     /// @return Value의 포인터 (없으면 nullptr)
-    V* Find(const K& key)
+    template<typename Q>
+    V* Find(const Q& key)
     {
-        auto it = m_data.find(key);
-        if (it != m_data.end())
+        Iterator it = m_data.Find(key);
+        if (it != m_data.End())
         {
             return &(it->second);
         }
@@ -63,12 +90,13 @@ public:
     }
 
     /// @brief Key로 Value 찾기 (const 버전)
-    /// @param key 찾을 키
+    /// @param key 찾을 키 (K 또는 K와 비교 가능한 타입)
     /// @return Value의 const 포인터 (없으면 nullptr)
-    const V* Find(const K& key) const
+    template<typename Q>
+    const V* Find(const Q& key) const
     {
-        auto it = m_data.find(key);
-        if (it != m_data.end())
+        ConstIterator it = m_data.Find(key);
+        if (it != m_data.End())
         {
             return &(it->second);
         }
@@ -76,11 +104,12 @@ public:
     }
 
     /// @brief Key 존재 여부 확인
-    /// @param key 확인할 키
+    /// @param key 확인할 키 (K 또는 K와 비교 가능한 타입)
     /// @return 존재하면 true, 없으면 false
-    bool8 Contains(const K& key) const
+    template<typename Q>
+    bool8 Contains(const Q& key) const
     {
-        return m_data.find(key) != m_data.end();
+        return m_data.Find(key) != m_data.End();
     }
 
     /// @brief Key로 Value 접근 (없으면 생성)
@@ -88,7 +117,7 @@ public:
     /// @return Value의 참조
     V& operator[](const K& key)
     {
-        return m_data[key];
+        return m_data.TryEmplace(key).first->second;
     }
 
     /// @brief Key로 Value 접근 (경계 검사, 없으면 예외)
@@ -96,7 +125,12 @@ public:
     /// @return Value의 참조
     V& GetAt(const K& key)
     {
-        return m_data.at(key);
+        V* value = Find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("TreeMap::GetAt - key not found");
+        }
+        return *value;
     }
 
     /// @brief Key로 Value 접근 (경계 검사, 없으면 예외, const 버전)
@@ -104,91 +138,166 @@ public:
     /// @return Value의 const 참조
     const V& GetAt(const K& key) const
     {
-        return m_data.at(key);
+        const V* value = Find(key);
+        if (value == nullptr)
+        {
+            throw std::out_of_range("TreeMap::GetAt - key not found");
+        }
+        return *value;
     }
 
     /// @brief 맵의 모든 요소 제거
     void Clear()
     {
-        m_data.clear();
+        m_data.Clear();
     }
 
     /// @brief 맵의 요소 개수 반환
     /// @return 요소 개수
     uint64 GetSize() const
     {
-        return static_cast<uint64>(m_data.size());
+        return m_data.GetSize();
     }
 
     /// @brief 맵이 비어있는지 확인
     /// @return 비어있으면 true, 아니면 false
     bool8 IsEmpty() const
     {
-        return m_data.empty();
+        return m_data.GetSize() == 0;
     }
 
-    /// @brief 모든 Key를 배열로 반환
-    /// @return Key들의 DynamicArray
-    DynamicArray<K> GetKeys() const
+    /// @brief 모든 Key를 복사 없이 순회하는 범위 반환
+    /// @return const K&를 돌려주는 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<KeyIterator> Keys() const
     {
-        DynamicArray<K> keys;
-        keys.Reserve(GetSize());
-        for (const auto& pair : m_data)
-        {
-            keys.Add(pair.first);
-        }
-        return keys;
+        return MakeProjectionRange<PairFirst>(Begin(), End());
     }
 
-    /// @brief 모든 Value를 배열로 반환
-    /// @return Value들의 DynamicArray
-    DynamicArray<V> GetValues() const
+    /// @brief 모든 Value를 복사 없이 순회하는 범위 반환
+    /// @return V&를 돌려주는 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<ValueIterator> Values()
     {
-        DynamicArray<V> values;
-        values.Reserve(GetSize());
-        for (const auto& pair : m_data)
-        {
-            values.Add(pair.second);
-        }
-        return values;
+        return MakeProjectionRange<PairSecond>(Begin(), End());
+    }
+
+    /// @brief 모든 Value를 복사 없이 순회하는 범위 반환 (const 버전)
+    /// @return const V&를 돌려주는 범위 (할당 없음, 맵을 수정하면 무효화됨)
+    IteratorRange<ConstValueIterator> Values() const
+    {
+        return MakeProjectionRange<PairSecond>(Begin(), End());
+    }
+
+    /// @brief 모든 Key-Value 쌍을 순회하는 범위 반환
+    /// @return 맵 전체 범위 (할당 없음)
+    IteratorRange<Iterator> Items()
+    {
+        return IteratorRange<Iterator>(Begin(), End());
+    }
+
+    /// @brief 모든 Key-Value 쌍을 순회하는 범위 반환 (const 버전)
+    /// @return 맵 전체 const 범위 (할당 없음)
+    IteratorRange<ConstIterator> Items() const
+    {
+        return IteratorRange<ConstIterator>(Begin(), End());
+    }
+
+    /// @brief Key 이상인 첫 번째 요소의 반복자 반환
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    Iterator LowerBound(const Q& key)
+    {
+        return m_data.LowerBound(key);
+    }
+
+    /// @brief Key 이상인 첫 번째 요소의 반복자 반환 (const 버전)
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return const 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator LowerBound(const Q& key) const
+    {
+        return m_data.LowerBound(key);
+    }
+
+    /// @brief Key보다 큰 첫 번째 요소의 반복자 반환
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    Iterator UpperBound(const Q& key)
+    {
+        return m_data.UpperBound(key);
+    }
+
+    /// @brief Key보다 큰 첫 번째 요소의 반복자 반환 (const 버전)
+    /// @param key 기준 키 (K 또는 K와 비교 가능한 타입)
+    /// @return const 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator UpperBound(const Q& key) const
+    {
+        return m_data.UpperBound(key);
+    }
+
+    /// @brief [first, last) 구간의 Key를 가진 요소들의 범위 반환
+    /// @param first 범위 시작 키 (포함)
+    /// @param last 범위 끝 키 (제외)
+    /// @return 정렬 순서로 순회하는 범위
+    IteratorRange<Iterator> Range(const K& first, const K& last)
+    {
+        return IteratorRange<Iterator>(m_data.LowerBound(first), m_data.LowerBound(last));
+    }
+
+    /// @brief [first, last) 구간의 Key를 가진 요소들의 범위 반환 (const 버전)
+    /// @param first 범위 시작 키 (포함)
+    /// @param last 범위 끝 키 (제외)
+    /// @return 정렬 순서로 순회하는 const 범위
+    IteratorRange<ConstIterator> Range(const K& first, const K& last) const
+    {
+        return IteratorRange<ConstIterator>(m_data.LowerBound(first), m_data.LowerBound(last));
     }
 
     /// @brief 맵의 시작 반복자 반환
     /// @return 시작 반복자
     Iterator Begin()
     {
-        return m_data.begin();
+        return m_data.Begin();
     }
 
     /// @brief 맵의 시작 반복자 반환 (const 버전)
     /// @return const 시작 반복자
     ConstIterator Begin() const
     {
-        return m_data.begin();
+        return m_data.Begin();
     }
 
     /// @brief 맵의 끝 반복자 반환
     /// @return 끝 반복자
     Iterator End()
     {
-        return m_data.end();
+        return m_data.End();
     }
 
     /// @brief 맵의 끝 반복자 반환 (const 버전)
     /// @return const 끝 반복자
     ConstIterator End() const
     {
-        return m_data.end();
+        return m_data.End();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return m_data.GetAllocator();
     }
 
     // Range-based for loop 지원
-    Iterator begin() { return m_data.begin(); }
-    ConstIterator begin() const { return m_data.begin(); }
-    Iterator end() { return m_data.end(); }
-    ConstIterator end() const { return m_data.end(); }
+    Iterator begin() { return m_data.Begin(); }
+    ConstIterator begin() const { return m_data.Begin(); }
+    Iterator end() { return m_data.End(); }
+    ConstIterator end() const { return m_data.End(); }
 
 private:
-    std::map<K, V> m_data;
+    StorageType m_data;
 };
 
 } // namespace Excep
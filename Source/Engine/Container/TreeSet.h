@@ -1,31 +1,50 @@
 ﻿#pragma once
 #include "Core/Types.h"
-#include "Container/DynamicArray.h"
-#include <set>
+#include "Container/BPlusTree.h"
+#include "Container/IteratorRange.h"
+#include "Memory/Allocator.h"
+#include <functional>
 #include <initializer_list>
 
 namespace Excep
 {
 
-/// @brief std::set을 래핑한 정렬된 unique 요소 집합 컨테이너
+/// @brief B+트리 기반의 정렬된 unique 요소 집합 컨테이너
 /// @tparam T 저장할 요소의 타입
-template<typename T>
+/// @tparam Alloc 엔진 할당자 타입 (기본값: DefaultAllocator)
+/// @note 요소는 노드마다 연속 배열에 저장됩니다. 삽입/삭제 시 기존 포인터와 반복자는 모두 무효화됩니다.
+///       Contains/Remove/LowerBound/UpperBound는 T와 < 비교가 되는 다른 타입(StringView8 등)을 그대로 받습니다.
+template<typename T, typename Alloc = DefaultAllocator>
 class TreeSet
 {
+private:
+    // std::less<>는 is_transparent이므로 T가 아닌 타입으로도 조회 가능
+    using StorageType = BPlusTree<T, BTreeNoValue, std::less<>, Alloc>;
+
 public:
-    using Iterator = typename std::set<T>::iterator;
-    using ConstIterator = typename std::set<T>::const_iterator;
+    using Iterator = typename StorageType::ConstIterator;
+    using ConstIterator = typename StorageType::ConstIterator;
 
     /// @brief 기본 생성자
     TreeSet()
     {
     }
 
+    /// @brief 할당자를 지정하여 생성
+    /// @param allocator 사용할 할당자
+    explicit TreeSet(const Alloc& allocator)
+        : m_data(allocator)
+    {
+    }
+
     /// @brief 초기화 리스트로 생성
     /// @param initList 초기화 리스트
     TreeSet(std::initializer_list<T> initList)
-        : m_data(initList)
     {
+        for (const auto& value : initList)
+        {
+            m_data.TryEmplace(value);
+        }
     }
 
     /// @brief 요소 삽입
@@ -33,95 +52,124 @@ public:
     /// @return 삽입 성공 시 true, 이미 존재하면 false
     bool8 Insert(const T& value)
     {
-        auto result = m_data.insert(value);
-        return result.second;
+        return m_data.TryEmplace(value).second;
     }
 
     /// @brief 요소 제거
-    /// @param value 제거할 요소
+    /// @param value 제거할 요소 (T 또는 T와 비교 가능한 타입)
     /// @return 제거 성공 시 true, 요소가 없으면 false
-    bool8 Remove(const T& value)
+    template<typename Q>
+    bool8 Remove(const Q& value)
     {
-        return m_data.erase(value) > 0;
+        return m_data.Remove(value);
     }
 
     /// @brief 요소 존재 여부 확인
-    /// @param value 확인할 요소
+    /// @param value 확인할 요소 (T 또는 T와 비교 가능한 타입)
     /// @return 존재하면 true, 없으면 false
-    bool8 Contains(const T& value) const
+    template<typename Q>
+    bool8 Contains(const Q& value) const
     {
-        return m_data.find(value) != m_data.end();
+        return m_data.Find(value) != m_data.End();
     }
 
     /// @brief 집합의 모든 요소 제거
     void Clear()
     {
-        m_data.clear();
+        m_data.Clear();
     }
 
     /// @brief 집합의 요소 개수 반환
     /// @return 요소 개수
     uint64 GetSize() const
     {
-        return static_cast<uint64>(m_data.size());
+        return m_data.GetSize();
     }
 
     /// @brief 집합이 비어있는지 확인
     /// @return 비어있으면 true, 아니면 false
     bool8 IsEmpty() const
     {
-        return m_data.empty();
+        return m_data.GetSize() == 0;
     }
 
-    /// @brief 모든 요소를 배열로 반환
-    /// @return 요소들의 DynamicArray (정렬된 순서)
-    DynamicArray<T> ToArray() const
+    /// @brief 모든 요소를 복사 없이 순회하는 범위 반환
+    /// @return 집합 전체 범위 (정렬된 순서, 할당 없음, 집합을 수정하면 무효화됨)
+    IteratorRange<ConstIterator> Items() const
     {
-        DynamicArray<T> array;
-        array.Reserve(GetSize());
-        for (const auto& value : m_data)
-        {
-            array.Add(value);
-        }
-        return array;
+        return IteratorRange<ConstIterator>(Begin(), End());
+    }
+
+    /// @brief value 이상인 첫 번째 요소의 반복자 반환
+    /// @param value 기준 값 (T 또는 T와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator LowerBound(const Q& value) const
+    {
+        return m_data.LowerBound(value);
+    }
+
+    /// @brief value보다 큰 첫 번째 요소의 반복자 반환
+    /// @param value 기준 값 (T 또는 T와 비교 가능한 타입)
+    /// @return 반복자 (없으면 End)
+    template<typename Q>
+    ConstIterator UpperBound(const Q& value) const
+    {
+        return m_data.UpperBound(value);
+    }
+
+    /// @brief [first, last) 구간의 요소들의 범위 반환
+    /// @param first 범위 시작 값 (포함)
+    /// @param last 범위 끝 값 (제외)
+    /// @return 정렬 순서로 순회하는 범위
+    IteratorRange<ConstIterator> Range(const T& first, const T& last) const
+    {
+        return IteratorRange<ConstIterator>(m_data.LowerBound(first), m_data.LowerBound(last));
     }
 
     /// @brief 집합의 시작 반복자 반환
     /// @return 시작 반복자
     Iterator Begin()
     {
-        return m_data.begin();
+        return m_data.Begin();
     }
 
     /// @brief 집합의 시작 반복자 반환 (const 버전)
     /// @return const 시작 반복자
     ConstIterator Begin() const
     {
-        return m_data.begin();
+        return m_data.Begin();
     }
 
     /// @brief 집합의 끝 반복자 반환
     /// @return 끝 반복자
     Iterator End()
     {
-        return m_data.end();
+        return m_data.End();
     }
 
     /// @brief 집합의 끝 반복자 반환 (const 버전)
     /// @return const 끝 반복자
     ConstIterator End() const
     {
-        return m_data.end();
+        return m_data.End();
+    }
+
+    /// @brief 사용 중인 할당자 반환
+    /// @return 할당자의 const 참조
+    const Alloc& GetAllocator() const
+    {
+        return m_data.GetAllocator();
     }
 
     // Range-based for loop 지원
-    Iterator begin() { return m_data.begin(); }
-    ConstIterator begin() const { return m_data.begin(); }
-    Iterator end() { return m_data.end(); }
-    ConstIterator end() const { return m_data.end(); }
+    Iterator begin() { return m_data.Begin(); }
+    ConstIterator begin() const { return m_data.Begin(); }
+    Iterator end() { return m_data.End(); }
+    ConstIterator end() const { return m_data.End(); }
 
 private:
-    std::set<T> m_data;
+    StorageType m_data;
 };
 
 } // namespace Excep
@@ -10,10 +10,31 @@
 // 엔진 컨테이너
 #include "Container/DynamicArray.h"
 #include "Container/StaticArray.h"
+#include "Container/SmallArray.h"
+#include "Container/InplaceArray.h"
+#include "Container/FrameArray.h"
+#include "Container/StableArray.h"
+#include "Container/Hive.h"
+#include "Container/SoAArray.h"
+#include "Container/BitArray.h"
+#include "Container/BitVector.h"
+#include "Container/PackedEnumArray.h"
+#include "Container/SlotMap.h"
+#include "Container/SparseSet.h"
+#include "Container/SpscQueue.h"
+#include "Container/MpmcQueue.h"
 #include "Container/TreeMap.h"
 #include "Container/HashMap.h"
+#include "Container/ConcurrentHashMap.h"
+#include "Container/FlatMap.h"
+#include "Container/FrozenHashMap.h"
 #include "Container/TreeSet.h"
 #include "Container/HashSet.h"
+#include "Container/FlatSet.h"
+#include "Container/LruCache.h"
+#include "Container/Sort.h"
+#include "Container/StringView8.h"
+#include "Container/StringView16.h"
 #include "Container/String8.h"
 #include "Container/String16.h"
 
@@ -0,0 +1,127 @@
+﻿#pragma once
+#include "Core/Types.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// SSE2 사용 가능 여부 (x64는 항상 지원, x86은 /arch:SSE2 이상)
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define EXCEP_SIMD_SSE2 1
+#include <emmintrin.h>
+#else
+#define EXCEP_SIMD_SSE2 0
+#endif
+
+namespace Excep
+{
+
+/// @brief 대상 CPU의 캐시 라인 크기 (스레드 간 false sharing을 막는 패딩 기준)
+constexpr uint64 CACHE_LINE_SIZE = 64;
+
+/// @brief 최하위 1비트 아래의 0 비트 개수를 반환합니다
+/// @param value 검사할 값 (0이 아니어야 함)
+/// @return 0 비트 개수
+inline uint32 CountTrailingZeros32(uint32 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<uint32>(index);
+#else
+    return static_cast<uint32>(__builtin_ctz(value));
+#endif
+}
+
+/// @brief 최하위 1비트 아래의 0 비트 개수를 반환합니다 (64비트)
+/// @param value 검사할 값 (0이 아니어야 함)
+/// @return 0 비트 개수
+inline uint32 CountTrailingZeros64(uint64 value)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32>(index);
+#elif defined(_MSC_VER)
+    const uint32 low = static_cast<uint32>(value);
+    return (low != 0) ? CountTrailingZeros32(low) : 32 + CountTrailingZeros32(static_cast<uint32>(value >> 32));
+#else
+    return static_cast<uint32>(__builtin_ctzll(value));
+#endif
+}
+
+/// @brief 최상위 1비트 위의 0 비트 개수를 반환합니다
+/// @param value 검사할 값 (0이 아니어야 함)
+/// @return 0 비트 개수
+inline uint32 CountLeadingZeros32(uint32 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return 31 - static_cast<uint32>(index);
+#else
+    return static_cast<uint32>(__builtin_clz(value));
+#endif
+}
+
+/// @brief 1인 비트의 개수를 반환합니다
+/// @param value 검사할 값
+/// @return 1인 비트 개수
+/// @note popcnt 명령은 AVX 이상을 대상으로 빌드할 때만 사용하고, 그 외에는 SWAR 방식으로 계산합니다
+inline uint32 CountSetBits64(uint64 value)
+{
+#if defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)
+    return static_cast<uint32>(__popcnt64(value));
+#elif defined(__GNUC__)
+    return static_cast<uint32>(__builtin_popcountll(value));
+#else
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<uint32>((value * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+/// @brief 주소가 속한 캐시 라인을 L1 캐시로 미리 가져옵니다
+/// @param address 미리 가져올 주소
+inline void Prefetch(const void* address)
+{
+#if EXCEP_SIMD_SSE2
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+/// @brief 스핀 대기 루프에서 CPU에 대기 중임을 알립니다
+/// @note 하이퍼스레딩 상대 스레드에 실행 자원을 양보하고, 루프 종료 시 메모리 순서 위반 페널티를 줄입니다
+inline void CpuPause()
+{
+#if EXCEP_SIMD_SSE2
+    _mm_pause();
+#endif
+}
+
+/// @brief value 이상인 가장 작은 2의 거듭제곱을 반환합니다
+/// @param value 기준 값
+/// @return 2의 거듭제곱 (value가 0이면 1)
+inline uint64 NextPowerOfTwo(uint64 value)
+{
+    if (value <= 1)
+    {
+        return 1;
+    }
+
+    --value;
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    value |= value >> 32;
+    return value + 1;
+}
+
+} // namespace Excep
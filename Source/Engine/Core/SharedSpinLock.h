@@ -0,0 +1,268 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include <atomic>
+#include <thread>
+
+namespace Excep
+{
+
+namespace SharedSpinLockDetail
+{
+
+/// @brief 한 스레드가 보유 중인 읽기 잠금
+struct HeldReadLock
+{
+    const void* locks;
+    uint64 index;
+    uint32 depth;
+};
+
+/// @brief 스레드마다 기억하는 보유 읽기 잠금의 최대 개수
+constexpr uint32 MAX_HELD_READ_LOCKS = 16;
+
+/// @brief 스레드별 잠금 상태 (읽기 슬롯 번호와 보유 중인 읽기 잠금 목록)
+struct ThreadState
+{
+    uint32 slot;
+    uint32 heldCount;
+    HeldReadLock held[MAX_HELD_READ_LOCKS];
+};
+
+/// @brief 현재 스레드의 잠금 상태 반환 (슬롯 번호는 처음 호출한 순서대로 배정)
+inline ThreadState& GetThreadState()
+{
+    static std::atomic<uint32> s_nextSlot(0);
+    thread_local ThreadState state = { s_nextSlot.fetch_add(1, std::memory_order_relaxed), 0, {} };
+    return state;
+}
+
+} // namespace SharedSpinLockDetail
+
+/// @brief 인덱스로 구분되는 읽기 공유/쓰기 배타 스핀 락 묶음 (읽기 카운트를 스레드 슬롯별로 분산)
+/// @tparam LockCount 락 개수 (샤드 개수 등)
+/// @note 읽기 카운트를 락마다 하나의 변수에 두면 모든 읽기가 같은 캐시 라인을 수정하므로
+///       읽기끼리 막지는 않아도 스레드 수만큼 캐시 라인이 오가며 확장되지 않습니다.
+///       그래서 스레드마다 READER_SLOT_COUNT개 중 하나의 읽기 슬롯(캐시 라인 단위)을 배정하고,
+///       읽기는 자기 슬롯의 카운트만 수정합니다. 쓰기는 쓰기 플래그를 세운 뒤 모든 슬롯의 카운트가
+///       0이 되기를 기다리므로 읽기보다 비싸며, 읽기가 대부분인 자료구조에 맞습니다.
+///       쓰기 요청이 들어오면 새 읽기를 막으므로 쓰기가 굶지 않습니다.
+///       이미 읽기 잠금을 보유한 스레드가 같은 락을 다시 읽기 잠그면 쓰기 대기를 확인하지 않고 들어갑니다
+///       (대기 중인 쓰기는 바깥 읽기의 해제를 기다리므로, 새 읽기까지 쓰기를 기다리면 교착됨).
+///       이를 위해 스레드마다 보유 중인 서로 다른 읽기 잠금을 MAX_HELD_READ_LOCKS개까지 기억합니다.
+///       읽기 잠금을 보유한 채 같은 락을 쓰기 잠그면 교착되므로 허용하지 않습니다.
+///       잠금 구간이 짧은 자료구조(샤드 해시 맵 등) 보호용이며, 오래 기다리면 스레드를 양보합니다.
+template<uint64 LockCount>
+class SharedSpinLockArray
+{
+public:
+    /// @brief 읽기 슬롯 개수 (이보다 많은 스레드는 슬롯을 나눠 쓰며, 정확성에는 영향 없음)
+    static constexpr uint32 READER_SLOT_COUNT = 32;
+
+    SharedSpinLockArray()
+    {
+        for (uint64 i = 0; i < LockCount; ++i)
+        {
+            m_writers[i].flag.store(0, std::memory_order_relaxed);
+        }
+        for (uint32 slot = 0; slot < READER_SLOT_COUNT; ++slot)
+        {
+            for (uint64 i = 0; i < LockCount; ++i)
+            {
+                m_readers[slot].counts[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 다른 스레드가 대기 중일 수 있는 상태를 가지므로 복사/이동 불가
+    SharedSpinLockArray(const SharedSpinLockArray&) = delete;
+    SharedSpinLockArray& operator=(const SharedSpinLockArray&) = delete;
+
+    /// @brief 읽기 잠금 (다른 읽기와 동시에 보유 가능)
+    /// @param index 락 인덱스
+    void LockShared(uint64 index)
+    {
+        SharedSpinLockDetail::ThreadState& thread = SharedSpinLockDetail::GetThreadState();
+        std::atomic<uint32>& count = m_readers[thread.slot % READER_SLOT_COUNT].counts[index];
+
+        // 재진입: 이 스레드의 카운트가 이미 0보다 크므로 쓰기는 들어올 수 없음
+        SharedSpinLockDetail::HeldReadLock* held = FindHeld(thread, index);
+        if (held != nullptr)
+        {
+            count.fetch_add(1, std::memory_order_relaxed);
+            ++held->depth;
+            return;
+        }
+
+        for (;;)
+        {
+            // 카운트 증가와 쓰기 플래그 확인이 쓰기 쪽의 순서(플래그 설정 -> 카운트 확인)와
+            // 엇갈리지 않아야 하므로 둘 다 seq_cst
+            count.fetch_add(1, std::memory_order_seq_cst);
+            if (m_writers[index].flag.load(std::memory_order_seq_cst) == 0)
+            {
+                break;
+            }
+
+            // 쓰기가 보유 또는 대기 중이면 카운트를 되돌리고 끝날 때까지 대기
+            count.fetch_sub(1, std::memory_order_relaxed);
+            WaitWhileNonZero(m_writers[index].flag);
+        }
+
+        // 목록이 가득 차면 기억하지 않음 (이 잠금에 대한 재진입은 쓰기를 기다릴 수 있음)
+        if (thread.heldCount < SharedSpinLockDetail::MAX_HELD_READ_LOCKS)
+        {
+            thread.held[thread.heldCount++] = SharedSpinLockDetail::HeldReadLock{ this, index, 1 };
+        }
+    }
+
+    /// @brief 읽기 잠금 해제 (잠근 스레드에서 호출해야 함)
+    /// @param index 락 인덱스
+    void UnlockShared(uint64 index)
+    {
+        SharedSpinLockDetail::ThreadState& thread = SharedSpinLockDetail::GetThreadState();
+        SharedSpinLockDetail::HeldReadLock* held = FindHeld(thread, index);
+        if (held != nullptr && --held->depth == 0)
+        {
+            *held = thread.held[--thread.heldCount];
+        }
+
+        m_readers[thread.slot % READER_SLOT_COUNT].counts[index].fetch_sub(1, std::memory_order_release);
+    }
+
+    /// @brief 쓰기 잠금 (같은 인덱스의 다른 모든 읽기/쓰기와 배타적)
+    /// @param index 락 인덱스
+    void Lock(uint64 index)
+    {
+        // 쓰기 플래그를 먼저 차지하여 새 읽기를 막음
+        std::atomic<uint32>& flag = m_writers[index].flag;
+        for (;;)
+        {
+            uint32 expected = 0;
+            if (flag.load(std::memory_order_relaxed) == 0 &&
+                flag.compare_exchange_weak(expected, 1, std::memory_order_seq_cst))
+            {
+                break;
+            }
+            WaitWhileNonZero(flag);
+        }
+
+        // 이미 들어와 있는 읽기가 모든 슬롯에서 나갈 때까지 대기
+        for (uint32 slot = 0; slot < READER_SLOT_COUNT; ++slot)
+        {
+            WaitWhileNonZero(m_readers[slot].counts[index]);
+        }
+    }
+
+    /// @brief 쓰기 잠금 해제
+    /// @param index 락 인덱스
+    void Unlock(uint64 index)
+    {
+        m_writers[index].flag.store(0, std::memory_order_release);
+    }
+
+private:
+    static constexpr uint32 SPIN_COUNT_BEFORE_YIELD = 64;
+
+    // 쓰기 플래그마다 캐시 라인을 따로 써서 한 락의 쓰기가 다른 락의 읽기를 방해하지 않도록 분리
+    struct WriterFlag
+    {
+        std::atomic<uint32> flag;
+        char8 padding[CACHE_LINE_SIZE - sizeof(std::atomic<uint32>)];
+    };
+
+    // 한 스레드 슬롯이 모든 락에 대해 가지는 읽기 카운트 (다른 슬롯과 캐시 라인을 공유하지 않도록 분리)
+    struct ReaderSlot
+    {
+        std::atomic<uint32> counts[LockCount];
+        char8 padding[CACHE_LINE_SIZE];
+    };
+
+    /// @brief 현재 스레드가 이 락 묶음의 index 락을 읽기 잠금 중이면 그 기록을 반환
+    SharedSpinLockDetail::HeldReadLock* FindHeld(SharedSpinLockDetail::ThreadState& thread, uint64 index) const
+    {
+        for (uint32 i = 0; i < thread.heldCount; ++i)
+        {
+            if (thread.held[i].locks == this && thread.held[i].index == index)
+            {
+                return &thread.held[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief 값이 0이 될 때까지 대기
+    static void WaitWhileNonZero(const std::atomic<uint32>& value)
+    {
+        uint32 spinCount = 0;
+        while (value.load(std::memory_order_seq_cst) != 0)
+        {
+            if (++spinCount < SPIN_COUNT_BEFORE_YIELD)
+            {
+                CpuPause();
+            }
+            else
+            {
+                spinCount = 0;
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    WriterFlag m_writers[LockCount];
+    ReaderSlot m_readers[READER_SLOT_COUNT];
+};
+
+/// @brief 범위 동안 읽기 잠금을 보유하는 RAII 가드
+/// @tparam LockArray SharedSpinLockArray 타입
+template<typename LockArray>
+class SharedLockGuard
+{
+public:
+    SharedLockGuard(LockArray& locks, uint64 index)
+        : m_locks(locks)
+        , m_index(index)
+    {
+        m_locks.LockShared(m_index);
+    }
+
+    ~SharedLockGuard()
+    {
+        m_locks.UnlockShared(m_index);
+    }
+
+    SharedLockGuard(const SharedLockGuard&) = delete;
+    SharedLockGuard& operator=(const SharedLockGuard&) = delete;
+
+private:
+    LockArray& m_locks;
+    uint64 m_index;
+};
+
+/// @brief 범위 동안 쓰기 잠금을 보유하는 RAII 가드
+/// @tparam LockArray SharedSpinLockArray 타입
+template<typename LockArray>
+class ExclusiveLockGuard
+{
+public:
+    ExclusiveLockGuard(LockArray& locks, uint64 index)
+        : m_locks(locks)
+        , m_index(index)
+    {
+        m_locks.Lock(m_index);
+    }
+
+    ~ExclusiveLockGuard()
+    {
+        m_locks.Unlock(m_index);
+    }
+
+    ExclusiveLockGuard(const ExclusiveLockGuard&) = delete;
+    ExclusiveLockGuard& operator=(const ExclusiveLockGuard&) = delete;
+
+private:
+    LockArray& m_locks;
+    uint64 m_index;
+};
+
+} // namespace Excep
@@ -424,14 +424,14 @@ bool8 D3D11Renderer::CompileShaders()
 {
     // Vertex Shader 파일 읽기
     String8 vertexShaderSource;
-    if (!ReadShaderFile(String16(L"Shaders/Default.vs.hlsl"), vertexShaderSource))
+    if (!ReadShaderFile(L"Shaders/Default.vs.hlsl", vertexShaderSource))
     {
         return false;
     }
 
     // Pixel Shader 파일 읽기
     String8 pixelShaderSource;
-    if (!ReadShaderFile(String16(L"Shaders/Default.ps.hlsl"), pixelShaderSource))
+    if (!ReadShaderFile(L"Shaders/Default.ps.hlsl", pixelShaderSource))
     {
         return false;
     }
@@ -546,22 +546,26 @@ bool8 D3D11Renderer::CreateRasterizerState()
     return SUCCEEDED(hr);
 }
 
-bool8 D3D11Renderer::ReadShaderFile(const String16& filename, String8& outSource)
+bool8 D3D11Renderer::ReadShaderFile(StringView16 filename, String8& outSource)
 {
     // 실행 파일의 경로 얻기
     char16 exePath[MAX_PATH];
-    GetModuleFileNameW(nullptr, exePath, MAX_PATH);
+    DWORD exePathLength = GetModuleFileNameW(nullptr, exePath, MAX_PATH);
 
-    // 실행 파일이 있는 디렉토리 추출
-    String16 exeDir = exePath;
-    uint64 lastSlash = exeDir.FindLastOf(String16(L"\\/"));
+    // 실행 파일이 있는 디렉토리 추출 (복사 없이 뷰로 자름)
+    StringView16 exeDir(exePath, exePathLength);
+    uint64 lastSlash = exeDir.FindLastOf(L"\\/");
     if (lastSlash != UINT64_MAX)
     {
         exeDir = exeDir.Substring(0, lastSlash);
     }
 
-    // 절대 경로 생성
-    String16 fullPath = exeDir + String16(L"\\") + filename;
+    // 절대 경로 생성 (한 번만 할당)
+    String16 fullPath;
+    fullPath.Reserve(exeDir.GetLength() + 1 + filename.GetLength());
+    fullPath.Append(exeDir);
+    fullPath.Append(L"\\");
+    fullPath.Append(filename);
 
     std::ifstream file(fullPath.GetCString(), std::ios::in | std::ios::binary);
     if (!file.is_open())
@@ -8,7 +8,7 @@ using Microsoft::WRL::ComPtr;
 namespace Excep
 {
 
-enum class MeshType
+enum class MeshType : uint8
 {
     Triangle,
     Cube,
@@ -88,7 +88,7 @@ private:
     bool8 CompileShaders();
     bool8 CreateInputLayout();
     bool8 CreateRasterizerState();
-    bool8 ReadShaderFile(const String16& filename, String8& outSource);
+    bool8 ReadShaderFile(StringView16 filename, String8& outSource);
 
     #pragma warning(push)
     #pragma warning(disable: 4251)  // ComPtr는 dll-interface가 필요하지 않음
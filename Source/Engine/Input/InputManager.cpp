@@ -6,8 +6,7 @@ namespace Excep
 
 InputManager::InputManager()
 {
-    m_currentKeyState.Fill(false);
-    m_previousKeyState.Fill(false);
+    // BitArray는 모든 비트가 0으로 생성됨
 }
 
 InputManager::~InputManager()
@@ -16,18 +15,15 @@ InputManager::~InputManager()
 
 void InputManager::Update()
 {
-    // 이전 프레임 상태를 현재 상태로 복사
-    for (int32 i = 0; i < KEY_COUNT; ++i)
-    {
-        m_previousKeyState[i] = m_currentKeyState[i];
-    }
+    // 이전 프레임 상태를 현재 상태로 복사 (256비트 = 워드 4개)
+    m_previousKeyState = m_currentKeyState;
 }
 
 void InputManager::ProcessKeyboardMessage(uint32 vkCode, bool8 isDown)
 {
     if (vkCode < KEY_COUNT)
     {
-        m_currentKeyState[vkCode] = isDown;
+        m_currentKeyState.Set(vkCode, isDown);
     }
 }
 
@@ -37,7 +33,7 @@ bool8 InputManager::IsKeyDown(uint32 vkCode) const
     {
         return false;
     }
-    return m_currentKeyState[vkCode];
+    return m_currentKeyState.Test(vkCode);
 }
 
 bool8 InputManager::IsKeyPressed(uint32 vkCode) const
@@ -46,7 +42,7 @@ bool8 InputManager::IsKeyPressed(uint32 vkCode) const
     {
         return false;
     }
-    return m_currentKeyState[vkCode] && !m_previousKeyState[vkCode];
+    return m_currentKeyState.Test(vkCode) && !m_previousKeyState.Test(vkCode);
 }
 
 bool8 InputManager::IsKeyReleased(uint32 vkCode) const
@@ -55,7 +51,7 @@ bool8 InputManager::IsKeyReleased(uint32 vkCode) const
     {
         return false;
     }
-    return !m_currentKeyState[vkCode] && m_previousKeyState[vkCode];
+    return !m_currentKeyState.Test(vkCode) && m_previousKeyState.Test(vkCode);
 }
 
 } // namespace Excep
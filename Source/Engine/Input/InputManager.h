@@ -1,6 +1,6 @@
 ﻿#pragma once
 #include "Core/ExcepAPI.h"
-#include "Container/StaticArray.h"
+#include "Container/BitArray.h"
 
 namespace Excep
 {
@@ -40,8 +40,8 @@ private:
 
     #pragma warning(push)
     #pragma warning(disable: 4251)
-    StaticArray<bool8, KEY_COUNT> m_currentKeyState;
-    StaticArray<bool8, KEY_COUNT> m_previousKeyState;
+    BitArray<KEY_COUNT> m_currentKeyState;
+    BitArray<KEY_COUNT> m_previousKeyState;
     #pragma warning(pop)
 };
 
@@ -0,0 +1,241 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+namespace Excep
+{
+
+/// @brief 엔진 메모리 할당자 인터페이스
+/// @note 프레임 아레나, 풀, 추적 힙 등은 이 인터페이스를 구현하고 AllocatorRef를 통해 컨테이너에 연결합니다
+class IAllocator
+{
+public:
+    virtual ~IAllocator() = default;
+
+    /// @brief 메모리 블록 할당
+    /// @param size 할당할 바이트 수
+    /// @param alignment 정렬 (2의 거듭제곱)
+    /// @return 할당된 메모리 포인터
+    virtual void* Allocate(uint64 size, uint64 alignment) = 0;
+
+    /// @brief 메모리 블록 해제
+    /// @param ptr Allocate가 반환한 포인터
+    /// @param size 할당 시 요청한 바이트 수
+    /// @param alignment 할당 시 요청한 정렬
+    virtual void Deallocate(void* ptr, uint64 size, uint64 alignment) = 0;
+};
+
+/// @brief 전역 힙을 사용하는 기본 할당자
+/// @note 상태가 없는 빈 타입이므로 컨테이너에 추가 메모리 비용이 없습니다
+struct DefaultAllocator
+{
+    static constexpr uint64 DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+    /// @brief 메모리 블록 할당
+    /// @param size 할당할 바이트 수
+    /// @param alignment 정렬 (2의 거듭제곱)
+    /// @return 할당된 메모리 포인터
+    void* Allocate(uint64 size, uint64 alignment) const
+    {
+        if (alignment <= DEFAULT_ALIGNMENT)
+        {
+            return ::operator new(static_cast<size_t>(size));
+        }
+
+#if defined(_MSC_VER)
+        void* ptr = _aligned_malloc(static_cast<size_t>(size), static_cast<size_t>(alignment));
+#else
+        void* ptr = aligned_alloc(static_cast<size_t>(alignment),
+                                  static_cast<size_t>((size + alignment - 1) & ~(alignment - 1)));
+#endif
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    /// @brief 메모리 블록 해제
+    /// @param ptr Allocate가 반환한 포인터
+    /// @param size 할당 시 요청한 바이트 수
+    /// @param alignment 할당 시 요청한 정렬
+    void Deallocate(void* ptr, uint64 size, uint64 alignment) const
+    {
+        (void)size;
+        if (alignment <= DEFAULT_ALIGNMENT)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        free(ptr);
+#endif
+    }
+
+    bool8 operator==(const DefaultAllocator&) const { return true; }
+    bool8 operator!=(const DefaultAllocator&) const { return false; }
+};
+
+/// @brief IAllocator 구현을 컨테이너 할당자로 사용하기 위한 참조 래퍼
+/// @note 참조 대상 할당자는 컨테이너보다 오래 살아있어야 합니다
+class AllocatorRef
+{
+public:
+    /// @brief IAllocator를 참조하여 생성
+    /// @param allocator 사용할 할당자
+    AllocatorRef(IAllocator& allocator)
+        : m_allocator(&allocator)
+    {
+    }
+
+    void* Allocate(uint64 size, uint64 alignment) const
+    {
+        return m_allocator->Allocate(size, alignment);
+    }
+
+    void Deallocate(void* ptr, uint64 size, uint64 alignment) const
+    {
+        m_allocator->Deallocate(ptr, size, alignment);
+    }
+
+    /// @brief 참조 중인 할당자 반환
+    /// @return IAllocator 포인터
+    IAllocator* Get() const { return m_allocator; }
+
+    bool8 operator==(const AllocatorRef& other) const { return m_allocator == other.m_allocator; }
+    bool8 operator!=(const AllocatorRef& other) const { return m_allocator != other.m_allocator; }
+
+private:
+    IAllocator* m_allocator;
+};
+
+/// @brief 다른 할당자로 위임하면서 할당량을 집계하는 추적 할당자
+class TrackingAllocator : public IAllocator
+{
+public:
+    /// @brief 추적 할당자 생성
+    /// @param name 통계 표시용 이름 (정적 수명 문자열)
+    /// @param parent 실제 할당을 위임할 할당자 (nullptr이면 전역 힙)
+    explicit TrackingAllocator(const char8* name, IAllocator* parent = nullptr)
+        : m_name(name)
+        , m_parent(parent)
+        , m_allocatedBytes(0)
+        , m_peakBytes(0)
+        , m_allocationCount(0)
+    {
+    }
+
+    void* Allocate(uint64 size, uint64 alignment) override
+    {
+        void* ptr = (m_parent != nullptr) ? m_parent->Allocate(size, alignment)
+                                          : DefaultAllocator().Allocate(size, alignment);
+
+        uint64 current = m_allocatedBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        uint64 peak = m_peakBytes.load(std::memory_order_relaxed);
+        while (current > peak && !m_peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+        {
+        }
+        m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    void Deallocate(void* ptr, uint64 size, uint64 alignment) override
+    {
+        m_allocatedBytes.fetch_sub(size, std::memory_order_relaxed);
+        if (m_parent != nullptr)
+        {
+            m_parent->Deallocate(ptr, size, alignment);
+        }
+        else
+        {
+            DefaultAllocator().Deallocate(ptr, size, alignment);
+        }
+    }
+
+    /// @brief 이름 반환
+    const char8* GetName() const { return m_name; }
+
+    /// @brief 현재 할당되어 있는 바이트 수 반환
+    uint64 GetAllocatedBytes() const { return m_allocatedBytes.load(std::memory_order_relaxed); }
+
+    /// @brief 최대 동시 할당 바이트 수 반환
+    uint64 GetPeakBytes() const { return m_peakBytes.load(std::memory_order_relaxed); }
+
+    /// @brief 누적 할당 횟수 반환
+    uint64 GetAllocationCount() const { return m_allocationCount.load(std::memory_order_relaxed); }
+
+private:
+    const char8* m_name;
+    IAllocator* m_parent;
+    std::atomic<uint64> m_allocatedBytes;
+    std::atomic<uint64> m_peakBytes;
+    std::atomic<uint64> m_allocationCount;
+};
+
+/// @brief 엔진 할당자를 STL 컨테이너에 연결하는 어댑터
+/// @tparam T 할당할 요소 타입
+/// @tparam Alloc 엔진 할당자 타입
+/// @note Alloc을 상속하므로 DefaultAllocator 사용 시 크기가 0인 빈 타입으로 최적화됩니다.
+///       이동 대입과 Swap에서 할당자도 함께 옮기므로 STL 기반 컨테이너도 엔진 컨테이너와 같이
+///       버퍼를 넘겨받습니다 (할당자가 달라도 요소 단위 이동이 일어나지 않음).
+template<typename T, typename Alloc>
+class StdAllocator : private Alloc
+{
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = StdAllocator<U, Alloc>;
+    };
+
+    StdAllocator()
+    {
+    }
+
+    StdAllocator(const Alloc& allocator)
+        : Alloc(allocator)
+    {
+    }
+
+    template<typename U>
+    StdAllocator(const StdAllocator<U, Alloc>& other)
+        : Alloc(other.GetAllocator())
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(Alloc::Allocate(static_cast<uint64>(count * sizeof(T)), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t count)
+    {
+        Alloc::Deallocate(ptr, static_cast<uint64>(count * sizeof(T)), alignof(T));
+    }
+
+    /// @brief 엔진 할당자 반환
+    const Alloc& GetAllocator() const { return *this; }
+
+    template<typename U>
+    bool8 operator==(const StdAllocator<U, Alloc>& other) const { return GetAllocator() == other.GetAllocator(); }
+
+    template<typename U>
+    bool8 operator!=(const StdAllocator<U, Alloc>& other) const { return !(*this == other); }
+};
+
+} // namespace Excep
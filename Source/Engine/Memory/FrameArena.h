@@ -0,0 +1,240 @@
+﻿#pragma once
+#include "Core/Types.h"
+#include "Core/Intrinsics.h"
+#include "Memory/Allocator.h"
+#include <cstdint>
+
+namespace Excep
+{
+
+/// @brief 한 프레임 동안 쓰는 임시 메모리를 위한 이중 버퍼 선형(bump) 할당자
+/// @note 할당은 포인터를 앞으로 미는 것이 전부이고 Deallocate는 아무 일도 하지 않으며,
+///       EndFrame에서 버퍼를 통째로 비웁니다 (O(1)).
+///       버퍼가 두 개이므로 N 프레임에 할당한 메모리는 N+1 프레임이 끝날 때까지 유효합니다.
+///       버퍼가 부족하면 넘친 요청만 부모 할당자에서 받고, 그 버퍼를 다시 쓸 때 필요한 만큼 키우므로
+///       사용량이 안정되면 더 이상 힙을 사용하지 않습니다.
+///       메인 스레드 전용입니다 (동기화 없음).
+class FrameArena final : public IAllocator
+{
+public:
+    /// @brief 버퍼 하나의 기본 용량 (1MB)
+    static constexpr uint64 DEFAULT_CAPACITY = 1024 * 1024;
+
+    /// @brief 생성자
+    /// @param capacity 버퍼 하나의 초기 용량 (바이트)
+    /// @param parent 버퍼와 넘친 요청을 할당할 부모 할당자 (nullptr이면 전역 힙)
+    explicit FrameArena(uint64 capacity = DEFAULT_CAPACITY, IAllocator* parent = nullptr)
+        : m_parent(parent)
+        , m_current(0)
+        , m_peakBytes(0)
+    {
+        for (Buffer& buffer : m_buffers)
+        {
+            buffer.base = static_cast<uint8*>(AllocateFromParent(capacity, CACHE_LINE_SIZE));
+            buffer.capacity = capacity;
+            buffer.offset = 0;
+            buffer.overflow = nullptr;
+            buffer.overflowBytes = 0;
+        }
+    }
+
+    ~FrameArena() override
+    {
+        for (Buffer& buffer : m_buffers)
+        {
+            ReleaseOverflow(buffer);
+            DeallocateToParent(buffer.base, buffer.capacity, CACHE_LINE_SIZE);
+        }
+    }
+
+    // 버퍼를 소유하므로 복사 불가
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /// @brief 현재 프레임 버퍼에서 메모리 블록 할당
+    /// @param size 할당할 바이트 수
+    /// @param alignment 정렬 (2의 거듭제곱)
+    /// @return 할당된 메모리 포인터 (다음 프레임이 끝날 때까지 유효)
+    void* Allocate(uint64 size, uint64 alignment) override
+    {
+        Buffer& buffer = m_buffers[m_current];
+        const uintptr_t base = reinterpret_cast<uintptr_t>(buffer.base);
+        const uintptr_t aligned = (base + buffer.offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        const uint64 end = static_cast<uint64>(aligned - base) + size;
+        if (end <= buffer.capacity)
+        {
+            buffer.offset = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        return AllocateOverflow(buffer, size, alignment);
+    }
+
+    /// @brief 아무 일도 하지 않음 (메모리는 버퍼를 비울 때 한꺼번에 회수)
+    void Deallocate(void* ptr, uint64 size, uint64 alignment) override
+    {
+        (void)ptr;
+        (void)size;
+        (void)alignment;
+    }
+
+    /// @brief 프레임 끝 처리: 다음 프레임이 쓸 버퍼로 전환하고 그 버퍼를 비움
+    /// @note 비우는 버퍼는 직전 프레임(N-1)의 메모리이므로, 이번 프레임(N)의 메모리는 다음 프레임까지 유지됩니다
+    void EndFrame()
+    {
+        const uint64 used = GetUsedBytes();
+        if (used > m_peakBytes)
+        {
+            m_peakBytes = used;
+        }
+
+        m_current ^= 1;
+        Buffer& buffer = m_buffers[m_current];
+        if (buffer.overflow != nullptr)
+        {
+            // 넘쳤던 버퍼는 그 프레임 사용량이 모두 들어가도록 키움
+            const uint64 required = buffer.offset + buffer.overflowBytes;
+            ReleaseOverflow(buffer);
+            DeallocateToParent(buffer.base, buffer.capacity, CACHE_LINE_SIZE);
+            buffer.capacity = NextPowerOfTwo(required);
+            buffer.base = static_cast<uint8*>(AllocateFromParent(buffer.capacity, CACHE_LINE_SIZE));
+        }
+        buffer.offset = 0;
+    }
+
+    /// @brief 현재 프레임에서 사용한 바이트 수 반환 (정렬 여백과 넘친 요청 포함)
+    /// @return 사용한 바이트 수
+    uint64 GetUsedBytes() const
+    {
+        const Buffer& buffer = m_buffers[m_current];
+        return buffer.offset + buffer.overflowBytes;
+    }
+
+    /// @brief 현재 프레임 버퍼의 용량 반환
+    /// @return 버퍼 용량 (바이트)
+    uint64 GetCapacity() const
+    {
+        return m_buffers[m_current].capacity;
+    }
+
+    /// @brief 지금까지 끝난 프레임 중 최대 사용량 반환
+    /// @return 최대 사용 바이트 수
+    uint64 GetPeakBytes() const
+    {
+        return m_peakBytes;
+    }
+
+    /// @brief 현재 프레임에서 버퍼가 넘쳐 부모 할당자를 사용했는지 확인
+    /// @return 넘쳤으면 true, 아니면 false
+    bool8 HasOverflowed() const
+    {
+        return m_buffers[m_current].overflow != nullptr;
+    }
+
+private:
+    /// @brief 버퍼가 넘친 요청을 위해 부모 할당자에서 받은 블록 (블록 앞에 위치)
+    struct OverflowHeader
+    {
+        OverflowHeader* next;
+        uint64 size;
+        uint64 alignment;
+    };
+
+    struct Buffer
+    {
+        uint8* base;
+        uint64 capacity;
+        uint64 offset;
+        OverflowHeader* overflow;
+        uint64 overflowBytes;
+    };
+
+    void* AllocateOverflow(Buffer& buffer, uint64 size, uint64 alignment)
+    {
+        // 헤더 뒤에 요청한 정렬을 맞춘 영역이 오도록 헤더 크기를 정렬 단위로 올림
+        const uint64 blockAlignment = (alignment > alignof(OverflowHeader)) ? alignment : alignof(OverflowHeader);
+        const uint64 headerSize = (sizeof(OverflowHeader) + blockAlignment - 1) & ~(blockAlignment - 1);
+        const uint64 blockSize = headerSize + size;
+
+        uint8* block = static_cast<uint8*>(AllocateFromParent(blockSize, blockAlignment));
+        OverflowHeader* header = reinterpret_cast<OverflowHeader*>(block);
+        header->next = buffer.overflow;
+        header->size = blockSize;
+        header->alignment = blockAlignment;
+        buffer.overflow = header;
+        buffer.overflowBytes += size;
+        return block + headerSize;
+    }
+
+    void ReleaseOverflow(Buffer& buffer)
+    {
+        OverflowHeader* header = buffer.overflow;
+        while (header != nullptr)
+        {
+            OverflowHeader* next = header->next;
+            DeallocateToParent(header, header->size, header->alignment);
+            header = next;
+        }
+        buffer.overflow = nullptr;
+        buffer.overflowBytes = 0;
+    }
+
+    void* AllocateFromParent(uint64 size, uint64 alignment)
+    {
+        return (m_parent != nullptr) ? m_parent->Allocate(size, alignment)
+                                     : DefaultAllocator().Allocate(size, alignment);
+    }
+
+    void DeallocateToParent(void* ptr, uint64 size, uint64 alignment)
+    {
+        if (m_parent != nullptr)
+        {
+            m_parent->Deallocate(ptr, size, alignment);
+        }
+        else
+        {
+            DefaultAllocator().Deallocate(ptr, size, alignment);
+        }
+    }
+
+    IAllocator* m_parent;
+    Buffer m_buffers[2];
+    uint64 m_current;       // 현재 프레임이 사용하는 버퍼 인덱스 (0 또는 1)
+    uint64 m_peakBytes;
+};
+
+/// @brief FrameArena를 컨테이너 할당자로 사용하기 위한 참조 래퍼
+/// @note AllocatorRef와 같은 역할이지만 FrameArena가 final이므로 가상 호출 없이 인라인됩니다.
+///       이 할당자를 쓰는 컨테이너는 할당한 프레임의 다음 프레임이 끝나기 전에 소멸되어야 합니다.
+class FrameAllocator
+{
+public:
+    /// @brief FrameArena를 참조하여 생성
+    /// @param arena 사용할 프레임 아레나
+    FrameAllocator(FrameArena& arena)
+        : m_arena(&arena)
+    {
+    }
+
+    void* Allocate(uint64 size, uint64 alignment) const
+    {
+        return m_arena->Allocate(size, alignment);
+    }
+
+    void Deallocate(void* ptr, uint64 size, uint64 alignment) const
+    {
+        m_arena->Deallocate(ptr, size, alignment);
+    }
+
+    /// @brief 참조 중인 프레임 아레나 반환
+    /// @return FrameArena 포인터
+    FrameArena* Get() const { return m_arena; }
+
+    bool8 operator==(const FrameAllocator& other) const { return m_arena == other.m_arena; }
+    bool8 operator!=(const FrameAllocator& other) const { return m_arena != other.m_arena; }
+
+private:
+    FrameArena* m_arena;
+};
+
+} // namespace Excep
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include "Memory/Allocator.h"
+#include "Memory/FrameArena.h"
 #include "Memory/UniquePtr.h"
 #include "Memory/SharedPtr.h"
 #include "Memory/WeakPtr.h"
@@ -1,7 +1,8 @@
 ﻿#pragma once
 #include "Core/ExcepAPI.h"
 #include "World/CComponent.h"
-#include "Container/DynamicArray.h"
+#include "Container/SmallArray.h"
+#include "Container/SlotMap.h"
 #include "Memory/UniquePtr.h"
 #include <typeinfo>
 
@@ -67,13 +68,25 @@ public:
     /// @return Transform 컴포넌트 포인터 (모든 WObject는 Transform을 가짐)
     CTransform* GetTransform() const { return m_transform; }
 
+    /// @brief World에서 이 오브젝트를 가리키는 핸들을 반환합니다
+    /// @return 오브젝트 핸들 (World에 추가되기 전에는 Null 핸들)
+    SlotHandle GetHandle() const { return m_handle; }
+
+    /// @brief 오브젝트 핸들을 설정합니다 (World에서 호출)
+    /// @param handle World가 발급한 핸들
+    void SetHandle(SlotHandle handle) { m_handle = handle; }
+
 private:
+    // 대부분의 오브젝트는 Transform + Renderer 정도만 가지므로 컴포넌트 목록을 오브젝트 내부에 저장
+    static constexpr uint64 INLINE_COMPONENT_COUNT = 4;
+
     #pragma warning(push)
     #pragma warning(disable: 4251)
-    DynamicArray<UniquePtr<CComponent>> m_components;
+    SmallArray<UniquePtr<CComponent>, INLINE_COMPONENT_COUNT> m_components;
     #pragma warning(pop)
 
     CTransform* m_transform; // 빠른 접근을 위한 Transform 참조 (실제 소유권은 m_components에 있음)
+    SlotHandle m_handle;
 };
 
 } // namespace Excep
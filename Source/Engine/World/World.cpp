@@ -1,6 +1,7 @@
 ﻿#include "Core/Pch.h"
 #include "World/World.h"
 #include "World/CRenderer.h"
+#include "Container/FrameArray.h"
 #include "Graphics/D3D11/D3D11Renderer.h"
 
 namespace Excep
@@ -12,22 +13,50 @@ World::World()
 
 WObject* World::SpawnObject()
 {
-    UniquePtr<WObject> obj = MakeUnique<WObject>();
-    WObject* ptr = obj.Get();
-    m_objects.Add(std::move(obj));
+    const uint64 index = m_objects.Emplace();
+    WObject* obj = &m_objects[index];
+    try
+    {
+        m_lastSpawned = m_handleToIndex.Insert(index);
+    }
+    catch (...)
+    {
+        // 핸들을 받지 못한 오브젝트는 찾거나 제거할 수 없으므로 슬롯을 되돌림
+        m_objects.RemoveAt(index);
+        throw;
+    }
+    obj->SetHandle(m_lastSpawned);
 
-    return ptr;
+    return obj;
+}
+
+WObject* World::FindObject(SlotHandle handle) const
+{
+    const uint64* index = m_handleToIndex.Find(handle);
+    return (index != nullptr) ? const_cast<WObject*>(&m_objects[*index]) : nullptr;
+}
+
+bool8 World::DestroyObject(SlotHandle handle)
+{
+    const uint64* index = m_handleToIndex.Find(handle);
+    if (index == nullptr)
+    {
+        return false;
+    }
+
+    m_objects.RemoveAt(*index);
+    return m_handleToIndex.Remove(handle);
 }
 
 void World::Update()
 {
-    for (uint64 i = 0; i < m_objects.GetSize(); ++i)
+    for (WObject& obj : m_objects)
     {
-        m_objects[i]->Update();
+        obj.Update();
     }
 }
 
-void World::Render(D3D11Renderer* renderer)
+void World::Render(D3D11Renderer* renderer, FrameArena& frameArena)
 {
     if (!renderer)
     {
@@ -37,23 +66,30 @@ void World::Render(D3D11Renderer* renderer)
     // 렌더링 시작
     renderer->BeginRender();
 
-    // 모든 오브젝트의 CRenderer 컴포넌트를 찾아서 Render() 호출
-    for (uint64 i = 0; i < m_objects.GetSize(); ++i)
+    // 1. CRenderer 컴포넌트를 가진 오브젝트를 수집 (프레임 아레나 사용, 힙 할당 없음)
+    FrameArray<CRenderer*> renderers(frameArena);
+    renderers.Reserve(m_objects.GetSize());
+    for (WObject& obj : m_objects)
     {
-        WObject* obj = m_objects[i].Get();
-
-        // CRenderer 컴포넌트를 가져옵니다
-        CRenderer* rendererComponent = obj->GetComponent<CRenderer>();
+        CRenderer* rendererComponent = obj.GetComponent<CRenderer>();
         if (rendererComponent)
         {
-            rendererComponent->Render(renderer);
+            renderers.Add(rendererComponent);
         }
     }
+
+    // 2. 수집한 순서(슬롯 인덱스 순서)대로 Render() 호출
+    //    제거된 슬롯은 나중에 생성된 오브젝트가 재사용하므로 생성 순서와는 다를 수 있음
+    for (CRenderer* rendererComponent : renderers)
+    {
+        rendererComponent->Render(renderer);
+    }
 }
 
 void World::Clear()
 {
     m_objects.Clear();
+    m_handleToIndex.Clear();
 }
 
 } // namespace Excep
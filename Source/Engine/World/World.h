@@ -1,8 +1,9 @@
 ﻿#pragma once
 #include "Core/ExcepAPI.h"
 #include "World/WObject.h"
-#include "Container/DynamicArray.h"
-#include "Memory/UniquePtr.h"
+#include "Container/SlotMap.h"
+#include "Container/StableArray.h"
+#include "Memory/FrameArena.h"
 
 // Forward declaration
 namespace Excep
@@ -20,7 +21,7 @@ public:
     World();
     ~World() = default;
 
-    // UniquePtr을 멤버로 가지므로 복사 불가
+    // 오브젝트를 값으로 소유하고 외부에 포인터를 넘기므로 복사/이동 불가
     World(const World&) = delete;
     World& operator=(const World&) = delete;
     World(World&&) = delete;
@@ -30,12 +31,23 @@ public:
     /// @return 생성된 WObject 포인터
     WObject* SpawnObject();
 
+    /// @brief 핸들로 오브젝트를 찾습니다
+    /// @param handle 오브젝트 핸들 (WObject::GetHandle)
+    /// @return 오브젝트 포인터, 이미 제거된 오브젝트의 핸들이면 nullptr
+    WObject* FindObject(SlotHandle handle) const;
+
+    /// @brief 오브젝트를 World에서 제거합니다
+    /// @param handle 제거할 오브젝트의 핸들
+    /// @return 제거 성공 시 true, 이미 제거된 오브젝트의 핸들이면 false
+    bool8 DestroyObject(SlotHandle handle);
+
     /// @brief 모든 오브젝트의 Update를 호출합니다
     void Update();
 
     /// @brief 모든 오브젝트를 렌더링합니다
     /// @param renderer D3D11Renderer 포인터
-    void Render(D3D11Renderer* renderer);
+    /// @param frameArena 렌더링 대상 수집 등 프레임 임시 메모리를 할당할 아레나
+    void Render(D3D11Renderer* renderer, FrameArena& frameArena);
 
     /// @brief 모든 오브젝트를 제거합니다
     void Clear();
@@ -45,21 +57,20 @@ public:
     uint64 GetObjectCount() const { return m_objects.GetSize(); }
 
     /// @brief 마지막에 추가된 오브젝트를 반환합니다
-    /// @return 마지막 오브젝트 포인터, 오브젝트가 없으면 nullptr
-    WObject* GetLastObject() const
-    {
-        if (m_objects.IsEmpty())
-        {
-            return nullptr;
-        }
-        return m_objects.GetBack().Get();
-    }
+    /// @return 마지막 오브젝트 포인터, 오브젝트가 없거나 이미 제거되었으면 nullptr
+    WObject* GetLastObject() const { return FindObject(m_lastSpawned); }
 
 private:
     #pragma warning(push)
     #pragma warning(disable: 4251)
-    DynamicArray<UniquePtr<WObject>> m_objects;
+    // 오브젝트는 청크에 값으로 저장되어 제거될 때까지 주소가 바뀌지 않음
+    StableArray<WObject> m_objects;
+
+    // 핸들 → m_objects 인덱스 (제거된 오브젝트의 핸들을 감지하기 위한 세대 검사용)
+    SlotMap<uint64> m_handleToIndex;
     #pragma warning(pop)
+
+    SlotHandle m_lastSpawned;
 };
 
 } // namespace Excep